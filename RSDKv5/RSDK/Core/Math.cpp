@@ -48,7 +48,8 @@ void RSDK::ClearTrigLookupTables()
 
 void RSDK::CalculateTrigAngles()
 {
-    srand((uint32)time(NULL));
+    // input recordings store the seed they were made with, so their replays roll the same numbers
+    srand(SKU::inputReplayMode != SKU::INPUTREPLAY_NONE ? SKU::inputReplaySeed : (uint32)time(NULL));
     randSeed = rand();
 
     for (int32 i = 0; i < 0x400; ++i) {
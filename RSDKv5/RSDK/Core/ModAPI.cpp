@@ -11,6 +11,9 @@ using namespace RSDK;
 #include <filesystem>
 #include <stdexcept>
 #include <functional>
+#include <thread>
+#include <deque>
+#include <unordered_map>
 
 #if RETRO_PLATFORM != RETRO_ANDROID
 namespace fs = std::filesystem;
@@ -195,6 +198,17 @@ void RSDK::InitModAPI(bool32 getVersion)
     ADD_MOD_FUNCTION(ModTable_FindRWallPosition, FindRWallPosition);
     ADD_MOD_FUNCTION(ModTable_CopyCollisionMask, CopyCollisionMask);
     ADD_MOD_FUNCTION(ModTable_GetCollisionInfo, GetCollisionInfo);
+
+    // Mod Settings (Part 3)
+    ADD_MOD_FUNCTION(ModTable_GetSettingsHandle, GetSettingsHandle);
+
+    // Objects/Entities (Part 2)
+    ADD_MOD_FUNCTION(ModTable_CreateEntities, CreateEntities);
+
+    // Snapshots
+    ADD_MOD_FUNCTION(ModTable_TakeSnapshot, TakeSnapshot);
+    ADD_MOD_FUNCTION(ModTable_RestoreSnapshot, RestoreSnapshot);
+    ADD_MOD_FUNCTION(ModTable_GetOldestSnapshot, GetOldestSnapshot);
 #endif
 
     superLevels.clear();
@@ -227,6 +241,9 @@ void RSDK::LoadModSettings()
 {
     customUserFileDir[0] = 0;
 
+    // active mods may have changed, so anything cached could be stale
+    RefreshModSettingsCache();
+
     modSettings.redirectSaveRAM  = false;
     modSettings.disableGameLogic = false;
 
@@ -332,14 +349,197 @@ void DrawStatus(const char *str)
     RenderDevice::FlipScreen();
 }
 
-#if RETRO_RENDERDEVICE_EGL
-// egl devices are slower in I/O so render more increments
-#define BAR_THRESHOLD (10.F)
-#define RENDER_COUNT  (200)
+#if RETRO_PLATFORM != RETRO_ANDROID
+#define MODCACHE_SIGNATURE (0x31434D52) // "RMC1"
+#define MODCACHE_FILENAME  "modCache.bin"
+
+// the contents of a single folder within a mod, used so unchanged folders don't need to be listed again
+struct ModFolderCache {
+    int64 writeTime = 0;
+    std::vector<std::string> files;
+    std::vector<std::string> folders;
+};
+
+int64 GetModFolderWriteTime(const fs::path &path)
+{
+    std::error_code err;
+    fs::file_time_type time = fs::last_write_time(path, err);
+    if (err)
+        return 0;
+
+    // folders modified within the timestamp granularity of the filesystem (2 seconds on FAT) could change again without their time changing,
+    // so don't trust them until next time
+    if (fs::file_time_type::clock::now() - time < std::chrono::seconds(2))
+        return 0;
+
+    return (int64)time.time_since_epoch().count();
+}
+
+void WriteModCacheString(FileIO *file, const std::string &str)
+{
+    uint16 len = (uint16)str.length();
+    fWrite(&len, sizeof(uint16), 1, file);
+    fWrite(str.c_str(), 1, len, file);
+}
+
+bool32 ReadModCacheString(FileIO *file, std::string &str)
+{
+    uint16 len = 0;
+    if (fRead(&len, sizeof(uint16), 1, file) != 1)
+        return false;
+
+    str.resize(len);
+    return !len || fRead(&str[0], 1, len, file) == len;
+}
+
+bool32 ReadModCacheList(FileIO *file, std::vector<std::string> &list)
+{
+    uint32 count = 0;
+    if (fRead(&count, sizeof(uint32), 1, file) != 1)
+        return false;
+
+    for (uint32 i = 0; i < count; ++i) {
+        std::string str;
+        if (!ReadModCacheString(file, str))
+            return false;
+        list.push_back(str);
+    }
+
+    return true;
+}
+
+void LoadModFolderCache(const std::string &modDir, std::map<std::string, ModFolderCache> &cache)
+{
+    FileIO *file = fOpen((modDir + "/" MODCACHE_FILENAME).c_str(), "rb");
+    if (!file)
+        return;
+
+    uint32 signature   = 0;
+    uint32 folderCount = 0;
+    bool32 valid       = fRead(&signature, sizeof(uint32), 1, file) == 1 && signature == MODCACHE_SIGNATURE;
+    valid              = valid && fRead(&folderCount, sizeof(uint32), 1, file) == 1;
+
+    for (uint32 f = 0; valid && f < folderCount; ++f) {
+        std::string path;
+        ModFolderCache folder;
+
+        valid = ReadModCacheString(file, path) && fRead(&folder.writeTime, sizeof(int64), 1, file) == 1;
+        valid = valid && ReadModCacheList(file, folder.files) && ReadModCacheList(file, folder.folders);
+
+        if (valid)
+            cache[path] = folder;
+    }
+
+    fClose(file);
+
+    // a broken cache is the same as no cache, everything gets listed again
+    if (!valid)
+        cache.clear();
+}
+
+void SaveModFolderCache(const std::string &modDir, std::map<std::string, ModFolderCache> &cache)
+{
+    FileIO *file = fOpen((modDir + "/" MODCACHE_FILENAME).c_str(), "wb");
+    if (!file)
+        return;
+
+    uint32 signature   = MODCACHE_SIGNATURE;
+    uint32 folderCount = (uint32)cache.size();
+    fWrite(&signature, sizeof(uint32), 1, file);
+    fWrite(&folderCount, sizeof(uint32), 1, file);
+
+    for (auto &folder : cache) {
+        WriteModCacheString(file, folder.first);
+        fWrite(&folder.second.writeTime, sizeof(int64), 1, file);
+
+        uint32 fileCount = (uint32)folder.second.files.size();
+        fWrite(&fileCount, sizeof(uint32), 1, file);
+        for (auto &name : folder.second.files) WriteModCacheString(file, name);
+
+        uint32 subFolderCount = (uint32)folder.second.folders.size();
+        fWrite(&subFolderCount, sizeof(uint32), 1, file);
+        for (auto &name : folder.second.folders) WriteModCacheString(file, name);
+    }
+
+    fClose(file);
+}
+
+void ScanModCacheFolder(const std::string &modDir, const std::string &folder, std::map<std::string, ModFolderCache> &cache,
+                        std::map<std::string, ModFolderCache> &scanned, bool32 *changed)
+{
+    fs::path path(folder.empty() ? modDir : modDir + "/" + folder);
+    int64 writeTime = GetModFolderWriteTime(path);
+
+    ModFolderCache &entry = scanned[folder];
+    auto cached           = cache.find(folder);
+    if (writeTime && cached != cache.end() && cached->second.writeTime == writeTime) {
+        entry = std::move(cached->second);
+    }
+    else {
+        // only this folder's entries get listed again, subfolders are still validated on their own
+        *changed        = true;
+        entry.writeTime = writeTime;
+
+        for (auto dirFile : fs::directory_iterator(path, fs::directory_options::follow_directory_symlink)) {
+            std::string name = dirFile.path().filename().string();
+
+            if (dirFile.is_directory())
+                entry.folders.push_back(name);
+            else if (!folder.empty() || name != MODCACHE_FILENAME)
+                entry.files.push_back(name);
+        }
+    }
+
+    for (auto &subFolder : entry.folders) ScanModCacheFolder(modDir, folder.empty() ? subFolder : folder + "/" + subFolder, cache, scanned, changed);
+}
+#endif
+
+void AddModFile(ModInfo *info, const std::string &filePath)
+{
+    std::string folderPath = filePath;
+    std::transform(folderPath.begin(), folderPath.end(), folderPath.begin(), [](unsigned char c) { return c == '\\' ? '/' : std::tolower(c); });
+
+    info->fileMap.insert(std::pair<std::string, std::string>(folderPath, info->path + "/" + filePath));
+}
+
+// builds a mod's fileMap, this doesn't touch the screen or the log so it's safe to run on a worker thread
+bool32 ScanModFolderFiles(ModInfo *info, std::string *error)
+{
+    info->fileMap.clear();
+
+    fs::path dataPath(info->path);
+    if (!fs::exists(dataPath) || !fs::is_directory(dataPath))
+        return false;
+
+    try {
+#if RETRO_PLATFORM != RETRO_ANDROID
+        // deleting modCache.bin will force the whole folder to be listed again
+        std::map<std::string, ModFolderCache> cache;
+        std::map<std::string, ModFolderCache> scanned;
+        bool32 changed = false;
+
+        LoadModFolderCache(info->path, cache);
+        ScanModCacheFolder(info->path, "", cache, scanned, &changed);
+
+        if (changed || cache.size() != scanned.size())
+            SaveModFolderCache(info->path, scanned);
+
+        for (auto &folder : scanned) {
+            for (auto &name : folder.second.files) AddModFile(info, folder.first.empty() ? name : folder.first + "/" + name);
+        }
 #else
-#define BAR_THRESHOLD (100.F)
-#define RENDER_COUNT  (200)
+        for (auto dirFile : fs::recursive_directory_iterator(dataPath, fs::directory_options::follow_directory_symlink)) {
+            AddModFile(info, dirFile.path().string().substr(dataPath.string().length() + 1));
+        }
 #endif
+    } catch (fs::filesystem_error fe) {
+        if (error)
+            *error = fe.what();
+        return false;
+    }
+
+    return true;
+}
 
 bool32 RSDK::ScanModFolder(ModInfo *info, const char *targetFile, bool32 fromLoadMod, bool32 loadingBar)
 {
@@ -348,23 +548,12 @@ bool32 RSDK::ScanModFolder(ModInfo *info, const char *targetFile, bool32 fromLoa
 
     const std::string modDir = info->path;
 
-    if (!targetFile)
-        info->fileMap.clear();
-
-    std::string targetFileStr = "";
     if (targetFile) {
         char pathLower[0x100];
         memset(pathLower, 0, sizeof(char) * 0x100);
         for (int32 c = 0; c < strlen(targetFile); ++c) pathLower[c] = tolower(targetFile[c]);
 
-        targetFileStr = std::string(pathLower);
-    }
-
-    fs::path dataPath(modDir);
-    int32 dy = currentScreen->center.y - 32;
-    int32 dx = currentScreen->center.x;
-
-    if (targetFile) {
+        std::string targetFileStr = std::string(pathLower);
         if (fs::exists(fs::path(modDir + "/" + targetFileStr))) {
             info->fileMap.insert(std::pair<std::string, std::string>(targetFileStr, modDir + "/" + targetFileStr));
             return true;
@@ -373,74 +562,98 @@ bool32 RSDK::ScanModFolder(ModInfo *info, const char *targetFile, bool32 fromLoa
             return false;
     }
 
-    if (fs::exists(dataPath) && fs::is_directory(dataPath)) {
-        try {
-            if (loadingBar) {
-                currentScreen = &screens[0];
-                DrawRectangle(dx - 0x80 + 0x10, dy + 48, 0x100 - 0x20, 0x10, 0x000000, 0xFF, INK_NONE, true);
-                DrawDevString(fromLoadMod ? "Getting count..." : ("Scanning " + info->id + "...").c_str(), currentScreen->center.x, dy + 52,
-                              ALIGN_CENTER, 0xFFFFFF);
-                RenderDevice::CopyFrameBuffer();
-                RenderDevice::FlipScreen();
-            }
+    int32 dy = currentScreen->center.y - 32;
+    int32 dx = currentScreen->center.x;
 
-            auto dirIterator = fs::recursive_directory_iterator(dataPath, fs::directory_options::follow_directory_symlink);
+    if (loadingBar) {
+        currentScreen = &screens[0];
+        DrawRectangle(dx - 0x80 + 0x10, dy + 48, 0x100 - 0x20, 0x10, 0x000000, 0xFF, INK_NONE, true);
+        DrawDevString(("Scanning " + info->id + "...").c_str(), currentScreen->center.x, dy + 52, ALIGN_CENTER, 0xFFFFFF);
+        RenderDevice::CopyFrameBuffer();
+        RenderDevice::FlipScreen();
+    }
 
-            std::vector<fs::directory_entry> files;
+    std::string error;
+    if (!ScanModFolderFiles(info, &error) && !error.empty())
+        PrintLog(PRINT_ERROR, "Mod File Scanning Error: %s", error.c_str());
 
-            int32 renders = 1;
-            int32 size    = 0;
+    if (loadingBar && fromLoadMod) {
+        DrawRectangle(dx - 0x80 + 0x10, dy + 48, 0x100 - 0x20, 0x10, 0x000080, 0xFF, INK_NONE, true);
 
-            for (auto dirFile : dirIterator) {
-#if RETRO_PLATFORM != RETRO_ANDROID
-                if (!dirFile.is_directory()) {
-#endif
-                    files.push_back(dirFile);
-
-                    if (loadingBar && ++size >= RENDER_COUNT * renders) {
-                        DrawRectangle(dx - 0x80 + 0x10, dy + 48, 0x100 - 0x20, 0x10, 0x000000, 0xFF, INK_NONE, true);
-                        DrawDevString((std::to_string(size) + " files").c_str(), currentScreen->center.x, dy + 52, ALIGN_CENTER, 0xFFFFFF);
-                        RenderDevice::CopyFrameBuffer();
-                        RenderDevice::FlipScreen();
-                        renders++;
-                    }
-#if RETRO_PLATFORM != RETRO_ANDROID
-                }
-#endif
-            }
+        RenderDevice::CopyFrameBuffer();
+        RenderDevice::FlipScreen();
+    }
 
-            int32 i    = 0;
-            int32 bars = 1;
-
-            for (auto dirFile : files) {
-                std::string folderPath = dirFile.path().string().substr(dataPath.string().length() + 1);
-                std::transform(folderPath.begin(), folderPath.end(), folderPath.begin(),
-                               [](unsigned char c) { return c == '\\' ? '/' : std::tolower(c); });
-
-                info->fileMap.insert(std::pair<std::string, std::string>(folderPath, dirFile.path().string()));
-                if (loadingBar && (size * bars) / BAR_THRESHOLD < ++i) {
-                    DrawRectangle(dx - 0x80 + 0x10, dy + 48, 0x100 - 0x20, 0x10, 0x000000, 0xFF, INK_NONE, true);
-                    DrawRectangle(dx - 0x80 + 0x10 + 2, dy + 50, (int32)((0x100 - 0x20 - 4) * (i / (float)size)), 0x10 - 4, 0x00FF00, 0xFF, INK_NONE,
-                                  true);
-                    while ((size * bars) / BAR_THRESHOLD < i) bars++;
-                    DrawDevString((std::to_string(i) + "/" + std::to_string(size)).c_str(), currentScreen->center.x, dy + 52, ALIGN_CENTER, 0xFFFFFF);
-                    RenderDevice::CopyFrameBuffer();
-                    RenderDevice::FlipScreen();
-                }
+    return true;
+}
+
+void RSDK::ScanModFolders(bool32 loadingBar)
+{
+    std::vector<ModInfo *> scanList;
+    for (ModInfo &mod : modList) {
+        if (mod.active)
+            scanList.push_back(&mod);
+    }
+
+#if RETRO_PLATFORM == RETRO_ANDROID
+    // the JNI filesystem calls have to stay on the main thread
+    for (ModInfo *mod : scanList) ScanModFolder(mod, nullptr, true, loadingBar);
+#else
+    int32 count = (int32)scanList.size();
+    if (!count)
+        return;
+
+    // every mod has its own fileMap, so they can all be scanned at the same time
+    JobGroup group;
+    std::atomic<int32> scannedCount(0);
+    std::vector<std::string> errors(count);
+    for (int32 m = 0; m < count; ++m) {
+        ModInfo *mod       = scanList[m];
+        std::string *error = &errors[m];
+        RunJob(&group, [mod, error, &scannedCount]() {
+            ScanModFolderFiles(mod, error);
+            scannedCount++;
+        });
+    }
+
+    int32 dy = currentScreen->center.y - 32;
+    int32 dx = currentScreen->center.x;
+    if (loadingBar) {
+        currentScreen = &screens[0];
+
+        int32 drawnCount = -1;
+        while (drawnCount != count) {
+            int32 scanCount = scannedCount.load();
+            if (scanCount != drawnCount) {
+                DrawRectangle(dx - 0x80 + 0x10, dy + 48, 0x100 - 0x20, 0x10, 0x000000, 0xFF, INK_NONE, true);
+                DrawRectangle(dx - 0x80 + 0x10 + 2, dy + 50, (int32)((0x100 - 0x20 - 4) * (scanCount / (float)count)), 0x10 - 4, 0x00FF00, 0xFF,
+                              INK_NONE, true);
+                DrawDevString(("Scanning mods " + std::to_string(scanCount) + "/" + std::to_string(count)).c_str(), currentScreen->center.x,
+                              dy + 52, ALIGN_CENTER, 0xFFFFFF);
+                RenderDevice::CopyFrameBuffer();
+                RenderDevice::FlipScreen();
+                drawnCount = scanCount;
+            }
+            else if (!RunPendingJob(&group)) {
+                std::this_thread::yield();
             }
-        } catch (fs::filesystem_error fe) {
-            PrintLog(PRINT_ERROR, "Mod File Scanning Error: %s", fe.what());
         }
     }
 
-    if (loadingBar && fromLoadMod) {
+    WaitForJobGroup(&group);
+
+    for (int32 m = 0; m < count; ++m) {
+        if (!errors[m].empty())
+            PrintLog(PRINT_ERROR, "Mod File Scanning Error: %s", errors[m].c_str());
+    }
+
+    if (loadingBar) {
         DrawRectangle(dx - 0x80 + 0x10, dy + 48, 0x100 - 0x20, 0x10, 0x000080, 0xFF, INK_NONE, true);
 
         RenderDevice::CopyFrameBuffer();
         RenderDevice::FlipScreen();
     }
-
-    return true;
+#endif
 }
 
 void RSDK::UnloadMods()
@@ -457,6 +670,7 @@ void RSDK::UnloadMods()
     }
 
     modList.clear();
+    RefreshModSettingsCache();
     for (int32 c = 0; c < MODCB_MAX; ++c) modCallbackList[c].clear();
     stateHookList.clear();
     objectHookList.clear();
@@ -577,6 +791,9 @@ void RSDK::LoadMods(bool newOnly, bool32 getVersion)
         }
     }
 
+    if (!getVersion)
+        ScanModFolders();
+
     int32 dy = currentScreen->center.y - 32;
     DrawRectangle(currentScreen->center.x - 128, dy, 0x100, 0x48, 0x80, 0xFF, INK_NONE, true);
     DrawDevString("Mod loading done!", currentScreen->center.x, dy + 28, ALIGN_CENTER, 0xFFFFFF);
@@ -694,8 +911,11 @@ bool32 RSDK::LoadMod(ModInfo *info, std::string modsPath, std::string folder, bo
         }
 
         // ASSETS
-        DrawStatus("Scanning mod folder...");
-        ScanModFolder(info, getVersion ? "Data/Game/GameConfig.bin" : nullptr, true);
+        // full scans are done for every active mod at once after they've all loaded, see ScanModFolders
+        if (getVersion) {
+            DrawStatus("Scanning mod folder...");
+            ScanModFolder(info, "Data/Game/GameConfig.bin", true);
+        }
 
         if (!getVersion) {
             // LOGIC
@@ -1096,31 +1316,126 @@ void RSDK::GetModPath(const char *id, String *result)
     InitString(result, modPath.c_str(), 0);
 }
 
-std::string GetModSettingsValue(const char *id, const char *key)
+// pre-parsed copies of the settings that have been asked for, so Get calls don't need to split & convert strings every time
+struct ModSettingsCacheEntry {
+    ModSettingsValue value;
+    std::string id;
+    std::string category;
+    std::string key;
+    std::string string;
+    bool32 intValid;
+    bool32 floatValid;
+};
+
+// deque so entries (and the handles pointing to them) never move
+std::deque<ModSettingsCacheEntry> modSettingsCache;
+std::unordered_map<std::string, ModSettingsCacheEntry *> modSettingsLookup;
+
+std::string GetModSettingsName(const char *id, const char *key)
 {
-    std::string skey(key);
+    std::string name(id);
+    name += '\0';
     if (!strchr(key, ':'))
-        skey = std::string(":") + key;
+        name += ':';
+    name += key;
 
-    std::string cat  = skey.substr(0, skey.find(":"));
-    std::string rkey = skey.substr(skey.find(":") + 1);
+    return name;
+}
+
+void ParseModSettingsEntry(ModSettingsCacheEntry *entry)
+{
+    entry->string.clear();
 
     for (ModInfo &m : modList) {
-        if (m.active && m.id == id) {
-            try {
-                return m.settings.at(cat).at(rkey);
-            } catch (std::out_of_range) {
-                return std::string();
+        if (m.active && m.id == entry->id) {
+            auto category = m.settings.find(entry->category);
+            if (category != m.settings.end()) {
+                auto key = category->second.find(entry->key);
+                if (key != category->second.end())
+                    entry->string = key->second;
             }
+            break;
         }
     }
-    return std::string();
+
+    entry->value.exists      = entry->string.length() != 0;
+    entry->value.stringValue = entry->string.c_str();
+    entry->value.intValue    = 0;
+    entry->value.floatValue  = 0.0f;
+    entry->intValid          = false;
+    entry->floatValid        = false;
+
+    if (entry->value.exists) {
+        try {
+            entry->value.intValue = std::stoi(entry->string, nullptr, 0);
+            entry->intValid       = true;
+        } catch (...) {
+        }
+
+        try {
+            entry->value.floatValue = std::stof(entry->string, nullptr);
+            entry->floatValid       = true;
+        } catch (...) {
+        }
+    }
+
+    char first             = entry->value.exists ? entry->string[0] : 0;
+    entry->value.boolValue = first == 'y' || first == 'Y' || first == 't' || first == 'T' || (entry->intValid && entry->value.intValue);
+}
+
+ModSettingsCacheEntry *GetModSettingsEntry(const char *id, const char *key)
+{
+    std::string name = GetModSettingsName(id, key);
+
+    auto lookup = modSettingsLookup.find(name);
+    if (lookup != modSettingsLookup.end())
+        return lookup->second;
+
+    modSettingsCache.emplace_back();
+    ModSettingsCacheEntry *entry = &modSettingsCache.back();
+
+    entry->id         = id;
+    const char *split = strchr(key, ':');
+    if (split) {
+        entry->category = std::string(key, split - key);
+        entry->key      = split + 1;
+    }
+    else {
+        entry->key = key;
+    }
+
+    ParseModSettingsEntry(entry);
+    modSettingsLookup[name] = entry;
+
+    return entry;
+}
+
+void RSDK::RefreshModSettingsCache()
+{
+    for (auto &entry : modSettingsCache) ParseModSettingsEntry(&entry);
+}
+
+const ModSettingsValue *RSDK::GetSettingsHandle(const char *id, const char *key)
+{
+    if (!id) {
+        // TODO: allow user to get values from settings.ini?
+        return NULL;
+    }
+    else if (!strlen(id)) {
+        if (!currentMod)
+            return NULL;
+
+        id = currentMod->id.c_str();
+    }
+
+    return &GetModSettingsEntry(id, key)->value;
 }
 
 bool32 RSDK::GetSettingsBool(const char *id, const char *key, bool32 fallback)
 {
     if (!id) {
         // TODO: allow user to get values from settings.ini?
+        return fallback;
     }
     else if (!strlen(id)) {
         if (!currentMod)
@@ -1129,27 +1444,22 @@ bool32 RSDK::GetSettingsBool(const char *id, const char *key, bool32 fallback)
         id = currentMod->id.c_str();
     }
 
-    std::string v = GetModSettingsValue(id, key);
+    ModSettingsCacheEntry *entry = GetModSettingsEntry(id, key);
 
-    if (!v.length()) {
-        if (currentMod->id == id)
+    if (!entry->value.exists) {
+        if (currentMod && currentMod->id == id)
             SetSettingsBool(key, fallback);
         return fallback;
     }
-    char first = v.at(0);
-    if (first == 'y' || first == 'Y' || first == 't' || first == 'T' || (first = GetSettingsInteger(id, key, 0)))
-        return true;
-    if (first == 'n' || first == 'N' || first == 'f' || first == 'F' || !first)
-        return false;
-    if (currentMod->id == id)
-        SetSettingsBool(key, fallback);
-    return fallback;
+
+    return entry->value.boolValue;
 }
 
 int32 RSDK::GetSettingsInteger(const char *id, const char *key, int32 fallback)
 {
     if (!id) {
         // TODO: allow user to get values from settings.ini?
+        return fallback;
     }
     else if (!strlen(id)) {
         if (!currentMod)
@@ -1158,26 +1468,22 @@ int32 RSDK::GetSettingsInteger(const char *id, const char *key, int32 fallback)
         id = currentMod->id.c_str();
     }
 
-    std::string v = GetModSettingsValue(id, key);
+    ModSettingsCacheEntry *entry = GetModSettingsEntry(id, key);
 
-    if (!v.length()) {
-        if (currentMod->id == id)
-            SetSettingsInteger(key, fallback);
-        return fallback;
-    }
-    try {
-        return std::stoi(v, nullptr, 0);
-    } catch (...) {
-        if (currentMod->id == id)
+    if (!entry->intValid) {
+        if (currentMod && currentMod->id == id)
             SetSettingsInteger(key, fallback);
         return fallback;
     }
+
+    return entry->value.intValue;
 }
 
 float RSDK::GetSettingsFloat(const char *id, const char *key, float fallback)
 {
     if (!id) {
         // TODO: allow user to get values from settings.ini?
+        return fallback;
     }
     else if (!strlen(id)) {
         if (!currentMod)
@@ -1186,26 +1492,23 @@ float RSDK::GetSettingsFloat(const char *id, const char *key, float fallback)
         id = currentMod->id.c_str();
     }
 
-    std::string v = GetModSettingsValue(id, key);
+    ModSettingsCacheEntry *entry = GetModSettingsEntry(id, key);
 
-    if (!v.length()) {
-        if (currentMod->id == id)
-            SetSettingsFloat(key, fallback);
-        return fallback;
-    }
-    try {
-        return std::stof(v, nullptr);
-    } catch (...) {
-        if (currentMod->id == id)
+    if (!entry->floatValid) {
+        if (currentMod && currentMod->id == id)
             SetSettingsFloat(key, fallback);
         return fallback;
     }
+
+    return entry->value.floatValue;
 }
 
 void RSDK::GetSettingsString(const char *id, const char *key, String *result, const char *fallback)
 {
     if (!id) {
         // TODO: allow user to get values from settings.ini?
+        InitString(result, fallback, 0);
+        return;
     }
     else if (!strlen(id)) {
         if (!currentMod) {
@@ -1216,14 +1519,14 @@ void RSDK::GetSettingsString(const char *id, const char *key, String *result, co
         id = currentMod->id.c_str();
     }
 
-    std::string v = GetModSettingsValue(id, key);
-    if (!v.length()) {
-        if (currentMod->id == id)
+    ModSettingsCacheEntry *entry = GetModSettingsEntry(id, key);
+    if (!entry->value.exists) {
+        if (currentMod && currentMod->id == id)
             SetSettingsString(key, result);
         InitString(result, fallback, 0);
         return;
     }
-    InitString(result, v.c_str(), 0);
+    InitString(result, entry->value.stringValue, 0);
 }
 
 std::string GetNidConfigValue(const char *key)
@@ -1239,7 +1542,7 @@ std::string GetNidConfigValue(const char *key)
 
     try {
         return currentMod->config.at(cat).at(rkey);
-    } catch (std::out_of_range) {
+    } catch (const std::out_of_range &) {
         return std::string();
     }
     return std::string();
@@ -1524,6 +1827,10 @@ void SetModSettingsValue(const char *key, std::string val)
     std::string rkey = skey.substr(skey.find(":") + 1);
 
     currentMod->settings[cat][rkey] = val;
+
+    auto lookup = modSettingsLookup.find(GetModSettingsName(currentMod->id.c_str(), key));
+    if (lookup != modSettingsLookup.end())
+        ParseModSettingsEntry(lookup->second);
 }
 
 void RSDK::SetSettingsBool(const char *key, bool32 val) { SetModSettingsValue(key, val ? "Y" : "N"); }
@@ -138,6 +138,17 @@ enum ModFunctionTableIDs {
     ModTable_FindRWallPosition,
     ModTable_CopyCollisionMask,
     ModTable_GetCollisionInfo,
+
+    // Mod Settings (Part 3)
+    ModTable_GetSettingsHandle,
+
+    // Objects/Entities (Part 2)
+    ModTable_CreateEntities,
+
+    // Snapshots
+    ModTable_TakeSnapshot,
+    ModTable_RestoreSnapshot,
+    ModTable_GetOldestSnapshot,
 #endif
 
     ModTable_Count
@@ -199,6 +210,15 @@ struct ModInfo {
     std::map<uint32 *, ModSVInfo> staticVars;
 };
 
+// a pre-parsed mod setting, handles stay valid & up to date until the engine closes so they can be read every frame
+struct ModSettingsValue {
+    bool32 exists;
+    bool32 boolValue;
+    int32 intValue;
+    float floatValue;
+    const char *stringValue;
+};
+
 struct StateHook {
     void (*state)();
     bool32 (*hook)(bool32 skippedState);
@@ -245,13 +265,19 @@ void LoadModSettings();
 void ApplyModChanges();
 
 bool32 ScanModFolder(ModInfo *info, const char *targetFile = nullptr, bool32 fromLoadMod = false, bool32 loadingBar = true);
+void ScanModFolders(bool32 loadingBar = true);
 inline void RefreshModFolders(bool32 versionOnly = false, bool32 loadingBar = true)
 {
     SortMods();
+    if (!versionOnly) {
+        ScanModFolders(loadingBar);
+        return;
+    }
+
     for (int32 m = 0; m < modList.size(); ++m) {
         if (!modList[m].active)
             break;
-        ScanModFolder(&modList[m], versionOnly ? "Data/Game/GameConfig.bin" : nullptr, true, loadingBar);
+        ScanModFolder(&modList[m], "Data/Game/GameConfig.bin", true, loadingBar);
     }
 }
 
@@ -306,6 +332,9 @@ int32 GetSettingsInteger(const char *id, const char *key, int32 fallback);
 float GetSettingsFloat(const char *id, const char *key, float fallback);
 void GetSettingsString(const char *id, const char *key, String *result, const char *fallback);
 
+const ModSettingsValue *GetSettingsHandle(const char *id, const char *key);
+void RefreshModSettingsCache();
+
 void SetSettingsBool(const char *key, bool32 val);
 void SetSettingsInteger(const char *key, int32 val);
 void SetSettingsFloat(const char *key, float val);
@@ -354,6 +383,10 @@ inline void *GetSpriteSurface(uint16 id)
 {
     if (id >= SURFACE_COUNT)
         return NULL;
+
+    // mods are free to write to the pixels, so the sheet's run table can't be trusted anymore
+    // it's only rebuilt when the sheet gets loaded again, until then the sheet is drawn the slower way
+    ClearSurfaceRuns(&gfxSurface[id]);
     return &gfxSurface[id];
 }
 inline uint16 *GetPaletteBank(uint8 id)
@@ -2,6 +2,9 @@
 
 using namespace RSDK;
 
+#include "ThreadPool.cpp"
+#include "Snapshot.cpp"
+
 #if RETRO_REV0U
 #include "Legacy/RetroEngineLegacy.cpp"
 #endif
@@ -30,10 +33,28 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
         InitConsole();
     RenderDevice::isRunning = false;
 
+    // the bench only needs storage & the software renderer, so it runs (and exits) before any devices or game logic get set up
+    if (engine.renderBench) {
+        int32 failures = RunRenderBench();
+
+        ReleaseLog();
+        if (engine.consoleEnabled)
+            ReleaseConsole();
+
+        return failures;
+    }
+
+    // needs to happen before the rand seed gets set up, since replays have to roll the same numbers as their recording did
+    SKU::InitInputReplay();
+
     if (InitStorage()) {
         SKU::InitUserCore();
         LoadSettingsINI();
 
+        // replays run as fast as they can, so don't let vsync hold them back either
+        if (SKU::inputReplayMode == SKU::INPUTREPLAY_PLAYBACK)
+            videoSettings.vsync = false;
+
 #if !RETRO_USE_ORIGINAL_CODE
         // temp fix till i properly figure out what exactly went wrong here
 #if RETRO_REV02
@@ -113,10 +134,11 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
         if (!RenderDevice::isRunning)
             break;
 
-        if (RenderDevice::CheckFPSCap()) {
+        if (RenderDevice::CheckFPSCap() || SKU::inputReplayMode == SKU::INPUTREPLAY_PLAYBACK) {
             RenderDevice::UpdateFPSCap();
 
             AudioDevice::FrameInit();
+            SKU::ProcessUserFileWrites();
 
 #if RETRO_REV02
             SKU::userCore->FrameInit();
@@ -323,6 +345,7 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
 
     // Shutdown
 
+    ReleaseVideo();
     ReleaseInputDevices();
     AudioDevice::Release();
     RenderDevice::Release(false);
@@ -336,6 +359,8 @@ int32 RSDK::RunRetroEngine(int32 argc, char *argv[])
     Link::Close(gameLogicHandle);
     gameLogicHandle = NULL;
 
+    ReleaseLog();
+
     if (engine.consoleEnabled)
         ReleaseConsole();
 
@@ -561,10 +586,13 @@ void RSDK::ProcessEngine()
             if (controller[0].keyStart.down)
                 sceneInfo.state = engine.storedState;
 
+            char message[sizeof(outputString)];
+            CopyOutputString(message);
+
             currentScreen = &screens[0];
-            int32 yOff    = DevOutput_GetStringYSize(outputString);
+            int32 yOff    = DevOutput_GetStringYSize(message);
             DrawRectangle(0, currentScreen->center.y - (yOff >> 1), currentScreen->size.x, yOff, 128, 255, INK_NONE, true);
-            DrawDevString(outputString, 8, currentScreen->center.y - (yOff >> 1) + 8, 0, 0xF0F0F0);
+            DrawDevString(message, 8, currentScreen->center.y - (yOff >> 1) + 8, 0, 0xF0F0F0);
             break;
         }
         case ENGINESTATE_ERRORMSG_FATAL: {
@@ -573,10 +601,13 @@ void RSDK::ProcessEngine()
             if (controller[0].keyStart.down)
                 RenderDevice::isRunning = false;
 
+            char message[sizeof(outputString)];
+            CopyOutputString(message);
+
             currentScreen = &screens[0];
-            int32 yOff    = DevOutput_GetStringYSize(outputString);
+            int32 yOff    = DevOutput_GetStringYSize(message);
             DrawRectangle(0, currentScreen->center.y - (yOff >> 1), currentScreen->size.x, yOff, 0xF00000, 255, INK_NONE, true);
-            DrawDevString(outputString, 8, currentScreen->center.y - (yOff >> 1) + 8, 0, 0xF0F0F0);
+            DrawDevString(message, 8, currentScreen->center.y - (yOff >> 1) + 8, 0, 0xF0F0F0);
             break;
         }
 #endif
@@ -628,6 +659,47 @@ void RSDK::ParseArguments(int32 argc, char *argv[])
             engine.consoleEnabled = true;
             engine.devMenu        = true;
         }
+
+        find = strstr(argv[a], "deferdraw=true");
+        if (find)
+            engine.deferredDrawing = true;
+
+        find = strstr(argv[a], "renderbench=");
+        if (find) {
+            int32 b = 0;
+            int32 c = 12;
+            while (find[c] && find[c] != ';' && b < (int32)sizeof(renderBenchGoldens) - 1) renderBenchGoldens[b++] = find[c++];
+            renderBenchGoldens[b] = 0;
+            engine.renderBench    = true;
+        }
+
+        find = strstr(argv[a], "renderbenchupdate=");
+        if (find) {
+            int32 b = 0;
+            int32 c = 18;
+            while (find[c] && find[c] != ';' && b < (int32)sizeof(renderBenchGoldens) - 1) renderBenchGoldens[b++] = find[c++];
+            renderBenchGoldens[b] = 0;
+            renderBenchUpdate     = true;
+            engine.renderBench    = true;
+        }
+
+        find = strstr(argv[a], "inputrecord=");
+        if (find) {
+            int32 b = 0;
+            int32 c = 12;
+            while (find[c] && find[c] != ';' && b < (int32)sizeof(SKU::inputReplayPath) - 1) SKU::inputReplayPath[b++] = find[c++];
+            SKU::inputReplayPath[b] = 0;
+            SKU::inputReplayMode    = SKU::INPUTREPLAY_RECORD;
+        }
+
+        find = strstr(argv[a], "inputreplay=");
+        if (find) {
+            int32 b = 0;
+            int32 c = 12;
+            while (find[c] && find[c] != ';' && b < (int32)sizeof(SKU::inputReplayPath) - 1) SKU::inputReplayPath[b++] = find[c++];
+            SKU::inputReplayPath[b] = 0;
+            SKU::inputReplayMode    = SKU::INPUTREPLAY_PLAYBACK;
+        }
     }
 }
 
@@ -1483,6 +1555,10 @@ void RSDK::InitCoreAPI()
 }
 void RSDK::ReleaseCoreAPI()
 {
+    SKU::FlushUserFileWrites();
+    ReleaseThreadPool();
+    ReleaseSnapshots();
+
 #if RETRO_RENDERDEVICE_SDL2 || RETRO_AUDIODEVICE_SDL2 || RETRO_INPUTDEVICE_SDL2
     SDL_Quit();
 #endif
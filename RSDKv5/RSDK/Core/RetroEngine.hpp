@@ -250,6 +250,27 @@ enum GameRegions {
 #define RETRO_MOD_LOADER_VER (2)
 #endif
 
+// enables SSE2/NEON versions of some of the hotter software rendering & 3D routines (they're bit-exact with the scalar versions)
+#ifndef RETRO_USE_SIMD
+#define RETRO_USE_SIMD (!RETRO_USE_ORIGINAL_CODE && 1)
+#endif
+
+#if RETRO_USE_SIMD && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RETRO_SIMD_SSE2 (1)
+#include <emmintrin.h>
+#elif RETRO_USE_SIMD && (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64))
+#define RETRO_SIMD_NEON (1)
+#include <arm_neon.h>
+#endif
+
+#ifndef RETRO_SIMD_SSE2
+#define RETRO_SIMD_SSE2 (0)
+#endif
+
+#ifndef RETRO_SIMD_NEON
+#define RETRO_SIMD_NEON (0)
+#endif
+
 // ============================
 // PLATFORM INIT
 // ============================
@@ -564,6 +585,7 @@ extern "C" {
 #include "RSDK/Core/Math.hpp"
 #include "RSDK/Storage/Text.hpp"
 #include "RSDK/Core/Reader.hpp"
+#include "RSDK/Core/ThreadPool.hpp"
 #include "RSDK/Graphics/Animation.hpp"
 #include "RSDK/Audio/Audio.hpp"
 #include "RSDK/Input/Input.hpp"
@@ -573,9 +595,11 @@ extern "C" {
 #include "RSDK/Graphics/Scene3D.hpp"
 #include "RSDK/Scene/Scene.hpp"
 #include "RSDK/Scene/Collision.hpp"
+#include "RSDK/Core/Snapshot.hpp"
 #include "RSDK/Graphics/Sprite.hpp"
 #include "RSDK/Graphics/Video.hpp"
 #include "RSDK/Dev/Debug.hpp"
+#include "RSDK/Dev/RenderBench.hpp"
 #include "RSDK/User/Core/UserCore.hpp"
 #include "RSDK/User/Core/UserAchievements.hpp"
 #include "RSDK/User/Core/UserLeaderboards.hpp"
@@ -650,6 +674,8 @@ struct RetroEngine {
     uint8 showUpdateRanges    = 0;
     uint8 showEntityInfo      = 0;
     bool32 drawGroupVisible[DRAWGROUP_COUNT];
+    bool32 deferredDrawing = false; // records sprites & rects during ProcessObjectDrawLists & rasterizes them in batches
+    bool32 renderBench     = false; // runs the headless renderer benchmark (see RenderBench.hpp) instead of the game
 
     // Image/Video support
     double displayTime       = 0.0;
@@ -0,0 +1,384 @@
+
+using namespace RSDK;
+
+uint8 *snapshotArena     = NULL;
+uint32 snapshotArenaSize = 0;
+
+SnapshotRegion snapshotRegions[SNAPSHOT_REGION_COUNT];
+void *snapshotLiveOwners[SNAPSHOT_REGION_COUNT]; // what the owners of stale regions point to right now, kept across a restore
+int32 snapshotRegionCount = 0;
+uint32 snapshotStateSize  = 0;
+
+SnapshotRecord snapshotRecords[SNAPSHOT_RECORD_COUNT];
+int32 snapshotRecordStart = 0;
+int32 snapshotRecordCount = 0;
+int32 latestSnapshotID    = -1;
+
+// the deltas are a ring after the shadow copy, each record is a list of (shadow offset, size) headers followed by the old bytes
+uint8 *snapshotDeltas     = NULL;
+uint32 snapshotDeltaSize  = 0;
+uint32 snapshotDeltaStart = 0;
+uint32 snapshotDeltaUsed  = 0;
+
+bool32 RSDK::InitSnapshots(uint32 arenaSize)
+{
+    ReleaseSnapshots();
+
+    snapshotArena = (uint8 *)malloc(arenaSize);
+    if (!snapshotArena)
+        return false;
+
+    snapshotArenaSize = arenaSize;
+    return true;
+}
+
+void RSDK::ReleaseSnapshots()
+{
+    ClearSnapshots();
+
+    if (snapshotArena)
+        free(snapshotArena);
+
+    snapshotArena     = NULL;
+    snapshotArenaSize = 0;
+}
+
+void RSDK::ClearSnapshots()
+{
+    snapshotRegionCount = 0;
+    snapshotStateSize   = 0;
+    snapshotRecordStart = 0;
+    snapshotRecordCount = 0;
+    snapshotDeltaStart  = 0;
+    snapshotDeltaUsed   = 0;
+    latestSnapshotID    = -1;
+}
+
+void AddSnapshotRegion(void **source, void *data, uint32 size)
+{
+    if (!data || !size || snapshotRegionCount >= SNAPSHOT_REGION_COUNT)
+        return;
+
+    // storage can be reached from more than one region, so make sure it's only captured once
+    for (int32 r = 0; r < snapshotRegionCount; ++r) {
+        if (snapshotRegions[r].data == data)
+            return;
+    }
+
+    SnapshotRegion *region = &snapshotRegions[snapshotRegionCount++];
+    region->source         = source;
+    region->data           = (uint8 *)data;
+    region->size           = size;
+    region->offset         = snapshotStateSize;
+    region->stale          = false;
+
+    // keeps blocks from ever straddling two regions
+    snapshotStateSize += (size + SNAPSHOT_BLOCK_SIZE - 1) & ~(SNAPSHOT_BLOCK_SIZE - 1);
+}
+
+bool32 InSnapshotRegion(void *ptr)
+{
+    for (int32 r = 0; r < snapshotRegionCount; ++r) {
+        SnapshotRegion *region = &snapshotRegions[r];
+        if ((uint8 *)ptr >= region->data && (uint8 *)ptr < region->data + region->size)
+            return true;
+    }
+
+    return false;
+}
+
+bool32 InLiveSnapshotRegion(void *ptr)
+{
+    for (int32 r = 0; r < snapshotRegionCount; ++r) {
+        SnapshotRegion *region = &snapshotRegions[r];
+        if (!region->stale && (uint8 *)ptr >= region->data && (uint8 *)ptr < region->data + region->size)
+            return true;
+    }
+
+    return false;
+}
+
+// storage gets moved by garbage collection & freed entries get their owner nulled, either way the region's stale
+// only those regions get dropped (along with any whose owner lived inside one), everything else keeps its snapshots
+void DropStaleSnapshotRegions()
+{
+    for (bool32 dropped = true; dropped;) {
+        dropped = false;
+
+        for (int32 r = 0; r < snapshotRegionCount; ++r) {
+            SnapshotRegion *region = &snapshotRegions[r];
+            if (region->stale || !region->source)
+                continue;
+
+            // if the owner itself got moved, it can't be trusted to point anywhere useful
+            bool32 stale = false;
+            for (int32 o = 0; o < snapshotRegionCount && !stale; ++o) {
+                SnapshotRegion *owner = &snapshotRegions[o];
+                stale = owner->stale && (uint8 *)region->source >= owner->data && (uint8 *)region->source < owner->data + owner->size;
+            }
+
+            if (stale || *region->source != region->data) {
+                PrintLog(PRINT_NORMAL, "Snapshot region %p (%d bytes) was moved or freed by storage, it won't be captured or restored anymore",
+                         region->data, region->size);
+                region->stale = true;
+                dropped       = true;
+            }
+        }
+    }
+}
+
+bool32 SetupSnapshotRegions()
+{
+    ClearSnapshots();
+
+    AddSnapshotRegion(NULL, objectEntityList, sizeof(objectEntityList));
+    AddSnapshotRegion(NULL, typeGroups, sizeof(typeGroups));
+    AddSnapshotRegion(NULL, &sceneInfo, sizeof(sceneInfo));
+    AddSnapshotRegion(NULL, tileLayers, sizeof(tileLayers));
+    AddSnapshotRegion(NULL, &randSeed, sizeof(randSeed));
+
+    AddSnapshotRegion(NULL, globalPalette, sizeof(globalPalette));
+    AddSnapshotRegion(NULL, activeGlobalRows, sizeof(activeGlobalRows));
+    AddSnapshotRegion(NULL, activeStageRows, sizeof(activeStageRows));
+    AddSnapshotRegion(NULL, stagePalette, sizeof(stagePalette));
+    AddSnapshotRegion(NULL, fullPalette, sizeof(fullPalette));
+    AddSnapshotRegion(NULL, gfxLineBuffer, sizeof(gfxLineBuffer));
+    AddSnapshotRegion(NULL, &maskColor, sizeof(maskColor));
+
+    AddSnapshotRegion(NULL, cameras, sizeof(cameras));
+    AddSnapshotRegion(NULL, &cameraCount, sizeof(cameraCount));
+    AddSnapshotRegion(NULL, &videoSettings.screenCount, sizeof(videoSettings.screenCount));
+    // the frame buffers are redrawn every frame anyway, so only the screen's position, size & clipping are kept
+    for (int32 s = 0; s < SCREEN_COUNT; ++s) AddSnapshotRegion(NULL, &screens[s].position, sizeof(ScreenInfo) - offsetof(ScreenInfo, position));
+
+    for (int32 o = 0; o < objectClassCount; ++o) {
+        ObjectClass *objClass = &objectClassList[o];
+        if (objClass->staticVars && *objClass->staticVars)
+            AddSnapshotRegion((void **)objClass->staticVars, *objClass->staticVars, objClass->staticClassSize);
+    }
+
+#if RETRO_USE_MOD_LOADER
+    for (ModInfo &mod : modList) {
+        for (auto &sVars : mod.staticVars) {
+            if (sVars.second.staticVars && *sVars.second.staticVars)
+                AddSnapshotRegion((void **)sVars.second.staticVars, *sVars.second.staticVars, sVars.second.size);
+        }
+    }
+#endif
+
+    // pick up any stage storage owned by something captured above (layer layouts, arrays hanging off static vars, etc)
+    // the allocator's own bookkeeping is left alone, sprites & such share the same dataset & would get freed from under their owners
+    DataStorage *storage = &dataStorage[DATASET_STG];
+    for (int32 prevCount = 0; prevCount != snapshotRegionCount;) {
+        prevCount = snapshotRegionCount;
+
+        for (uint32 e = 0; e < storage->entryCount; ++e) {
+            uint32 **owner = storage->dataEntries[e];
+            if (owner && *owner == storage->storageEntries[e] && InSnapshotRegion(owner))
+                AddSnapshotRegion((void **)owner, *owner, GetStorageSize(*owner));
+        }
+    }
+
+    // the rest of the arena needs to fit at least one delta for snapshots to be of any use
+    if (snapshotStateSize + SNAPSHOT_BLOCK_SIZE > snapshotArenaSize) {
+        PrintLog(PRINT_NORMAL, "Snapshot state (%d bytes) doesn't fit in the snapshot arena (%d bytes)", snapshotStateSize, snapshotArenaSize);
+        ClearSnapshots();
+        return false;
+    }
+
+    snapshotDeltas    = &snapshotArena[snapshotStateSize];
+    snapshotDeltaSize = snapshotArenaSize - snapshotStateSize;
+    return true;
+}
+
+void DropOldestSnapshotRecord()
+{
+    SnapshotRecord *record = &snapshotRecords[snapshotRecordStart];
+
+    snapshotDeltaStart  = (snapshotDeltaStart + record->size) % snapshotDeltaSize;
+    snapshotDeltaUsed   = snapshotDeltaUsed - record->size;
+    snapshotRecordStart = (snapshotRecordStart + 1) % SNAPSHOT_RECORD_COUNT;
+    --snapshotRecordCount;
+}
+
+// drops the oldest records until there's room for size more bytes, returns false if the record being written can't fit at all
+bool32 ReserveSnapshotDelta(uint32 size)
+{
+    while (snapshotDeltaUsed + size > snapshotDeltaSize) {
+        if (!snapshotRecordCount)
+            return false;
+
+        DropOldestSnapshotRecord();
+    }
+
+    return true;
+}
+
+void WriteSnapshotDelta(const void *src, uint32 size)
+{
+    uint32 pos   = (snapshotDeltaStart + snapshotDeltaUsed) % snapshotDeltaSize;
+    uint32 first = MIN(size, snapshotDeltaSize - pos);
+
+    memcpy(&snapshotDeltas[pos], src, first);
+    memcpy(snapshotDeltas, (const uint8 *)src + first, size - first);
+    snapshotDeltaUsed += size;
+}
+
+void ReadSnapshotDelta(uint32 offset, void *dst, uint32 size)
+{
+    uint32 pos   = offset % snapshotDeltaSize;
+    uint32 first = MIN(size, snapshotDeltaSize - pos);
+
+    memcpy(dst, &snapshotDeltas[pos], first);
+    memcpy((uint8 *)dst + first, snapshotDeltas, size - first);
+}
+
+int32 RSDK::TakeSnapshot()
+{
+#if RETRO_REV0U
+    // legacy scenes keep their state elsewhere
+    if (engine.version != 5)
+        return -1;
+#endif
+
+    if (!snapshotArena && !InitSnapshots(SNAPSHOT_ARENA_SIZE))
+        return -1;
+
+    DropStaleSnapshotRegions();
+
+    if (!snapshotRegionCount && !SetupSnapshotRegions())
+        return -1;
+
+    // nothing to compare against yet, so the first one's a straight copy
+    if (latestSnapshotID < 0) {
+        for (int32 r = 0; r < snapshotRegionCount; ++r) {
+            if (!snapshotRegions[r].stale)
+                memcpy(&snapshotArena[snapshotRegions[r].offset], snapshotRegions[r].data, snapshotRegions[r].size);
+        }
+
+        latestSnapshotID = 0;
+        return latestSnapshotID;
+    }
+
+    if (snapshotRecordCount == SNAPSHOT_RECORD_COUNT)
+        DropOldestSnapshotRecord();
+
+    // the shadow copy gets moved up to the new snapshot, & the blocks it overwrites are kept so the previous one can still be restored
+    SnapshotRecord record;
+    record.id        = latestSnapshotID;
+    record.offset    = (snapshotDeltaStart + snapshotDeltaUsed) % snapshotDeltaSize;
+    record.size      = 0;
+    bool32 keepDelta = true;
+
+    for (int32 r = 0; r < snapshotRegionCount; ++r) {
+        SnapshotRegion *region = &snapshotRegions[r];
+        if (region->stale)
+            continue;
+
+        uint8 *live   = region->data;
+        uint8 *shadow = &snapshotArena[region->offset];
+
+        uint32 pos = 0;
+        while (pos < region->size) {
+            uint32 blockSize = MIN(SNAPSHOT_BLOCK_SIZE, region->size - pos);
+            if (!memcmp(&live[pos], &shadow[pos], blockSize)) {
+                pos += blockSize;
+                continue;
+            }
+
+            // grow the run over every changed block that follows
+            uint32 runStart = pos;
+            pos += blockSize;
+            while (pos < region->size) {
+                blockSize = MIN(SNAPSHOT_BLOCK_SIZE, region->size - pos);
+                if (!memcmp(&live[pos], &shadow[pos], blockSize))
+                    break;
+
+                pos += blockSize;
+            }
+
+            uint32 entry[2] = { region->offset + runStart, pos - runStart };
+            if (keepDelta) {
+                keepDelta = ReserveSnapshotDelta(sizeof(entry) + entry[1]);
+
+                if (keepDelta) {
+                    WriteSnapshotDelta(entry, sizeof(entry));
+                    WriteSnapshotDelta(&shadow[runStart], entry[1]);
+                    record.size += sizeof(entry) + entry[1];
+                }
+                else {
+                    // everything older was already dropped trying to make room, so there's nothing left to step back to
+                    PrintLog(PRINT_NORMAL, "Snapshot delta doesn't fit in the snapshot arena, older snapshots were dropped");
+                    snapshotDeltaStart = 0;
+                    snapshotDeltaUsed  = 0;
+                }
+            }
+
+            memcpy(&shadow[runStart], &live[runStart], entry[1]);
+        }
+    }
+
+    if (keepDelta)
+        snapshotRecords[(snapshotRecordStart + snapshotRecordCount++) % SNAPSHOT_RECORD_COUNT] = record;
+
+    return ++latestSnapshotID;
+}
+
+bool32 RSDK::RestoreSnapshot(int32 id)
+{
+    if (id < 0 || id < GetOldestSnapshot() || id > latestSnapshotID)
+        return false;
+
+    DropStaleSnapshotRegions();
+
+    // undo the deltas newest first until the shadow copy is back at the requested snapshot
+    while (latestSnapshotID > id) {
+        SnapshotRecord *record = &snapshotRecords[(snapshotRecordStart + snapshotRecordCount - 1) % SNAPSHOT_RECORD_COUNT];
+
+        for (uint32 pos = 0; pos < record->size;) {
+            uint32 entry[2];
+            ReadSnapshotDelta(record->offset + pos, entry, sizeof(entry));
+            ReadSnapshotDelta(record->offset + pos + sizeof(entry), &snapshotArena[entry[0]], entry[1]);
+
+            pos += sizeof(entry) + entry[1];
+        }
+
+        snapshotDeltaUsed -= record->size;
+        --snapshotRecordCount;
+        latestSnapshotID = record->id;
+    }
+
+    // keep whatever entity loop the restore was called from on track
+    Entity *entity    = sceneInfo.entity;
+    uint16 entitySlot = sceneInfo.entitySlot;
+
+    // the owners of stale regions (static vars, layer layouts, etc) were captured pointing at storage that's since been moved or freed
+    // so whatever they point to now is kept, otherwise the restore would hand the dangling pointers back to them
+    for (int32 r = 0; r < snapshotRegionCount; ++r) {
+        SnapshotRegion *region = &snapshotRegions[r];
+        if (region->stale && region->source && InLiveSnapshotRegion(region->source))
+            snapshotLiveOwners[r] = *region->source;
+    }
+
+    // older deltas can still hold blocks from stale regions, those only ever land in the shadow copy
+    for (int32 r = 0; r < snapshotRegionCount; ++r) {
+        if (!snapshotRegions[r].stale)
+            memcpy(snapshotRegions[r].data, &snapshotArena[snapshotRegions[r].offset], snapshotRegions[r].size);
+    }
+
+    for (int32 r = 0; r < snapshotRegionCount; ++r) {
+        SnapshotRegion *region = &snapshotRegions[r];
+        if (region->stale && region->source && InLiveSnapshotRegion(region->source))
+            *region->source = snapshotLiveOwners[r];
+    }
+
+    sceneInfo.entity     = entity;
+    sceneInfo.entitySlot = entitySlot;
+
+    // every entity may have changed, so the passes after the main update need to visit all of them this frame
+    memset(scheduledEntityMask, 0xFF, sizeof(scheduledEntityMask));
+
+    return true;
+}
+
+int32 RSDK::GetOldestSnapshot() { return snapshotRecordCount ? snapshotRecords[snapshotRecordStart].id : latestSnapshotID; }
@@ -0,0 +1,45 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+namespace RSDK
+{
+
+#define SNAPSHOT_ARENA_SIZE   (64 * 1024 * 1024) // 64MB, used if TakeSnapshot is called before InitSnapshots
+#define SNAPSHOT_REGION_COUNT (0x800)
+#define SNAPSHOT_RECORD_COUNT (0x400)
+#define SNAPSHOT_BLOCK_SIZE   (0x100) // state is compared against the previous snapshot this many bytes at a time
+
+// a chunk of engine state that gets captured
+// regions that live in storage keep track of the pointer that owns them, so they can be thrown out if storage moves them
+struct SnapshotRegion {
+    void **source;
+    uint8 *data;
+    uint32 size;
+    uint32 offset; // into the shadow copy
+    bool32 stale;  // storage moved or freed it, it keeps its spot in the shadow copy but isn't captured or restored anymore,
+                   // & its owner keeps pointing wherever it does now when a snapshot is restored
+};
+
+// everything needed to step back from one snapshot to the one before it: the blocks that got overwritten when it was taken
+struct SnapshotRecord {
+    int32 id;
+    uint32 offset; // into the delta ring
+    uint32 size;
+};
+
+// the arena is allocated up front, the latest snapshot is kept whole at the start of it & the rest holds the deltas for older ones
+bool32 InitSnapshots(uint32 arenaSize);
+void ReleaseSnapshots();
+// drops every snapshot & rebuilds the region list the next time one is taken, called whenever a scene starts loading
+void ClearSnapshots();
+
+// returns the new snapshot's id, or -1 if it couldn't be taken
+int32 TakeSnapshot();
+// puts the engine back into the state it was in when snapshot id was taken & drops any snapshots newer than it
+bool32 RestoreSnapshot(int32 id);
+// the oldest snapshot that can still be restored, older ones get dropped as the arena fills up. -1 if there's none
+int32 GetOldestSnapshot();
+
+} // namespace RSDK
+
+#endif // !SNAPSHOT_H
@@ -0,0 +1,126 @@
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+
+using namespace RSDK;
+
+struct PoolJob {
+    JobGroup *group;
+    JobCallback callback;
+};
+
+std::vector<std::thread> poolWorkers;
+std::deque<PoolJob> poolJobs;
+std::mutex poolMutex;
+std::condition_variable poolSignal;
+bool32 poolActive = false;
+std::atomic<int32> poolWorkerCount(-1);
+
+void PoolWorkerLoop()
+{
+    while (true) {
+        PoolJob job;
+        {
+            std::unique_lock<std::mutex> lock(poolMutex);
+            poolSignal.wait(lock, [] { return !poolActive || !poolJobs.empty(); });
+
+            if (poolJobs.empty())
+                return; // pool was released and there's nothing left to do
+
+            job = std::move(poolJobs.front());
+            poolJobs.pop_front();
+        }
+
+        job.callback();
+        if (job.group)
+            job.group->pending--;
+    }
+}
+
+void RSDK::InitThreadPool()
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    if (poolWorkerCount != -1)
+        return;
+
+    // leave a core free for the main thread
+    int32 cores     = (int32)std::thread::hardware_concurrency();
+    poolWorkerCount = CLAMP(cores - 1, 0, THREADPOOL_WORKER_MAX);
+    poolActive      = true;
+
+    for (int32 w = 0; w < poolWorkerCount; ++w) poolWorkers.push_back(std::thread(PoolWorkerLoop));
+}
+
+void RSDK::ReleaseThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        poolActive = false;
+    }
+    poolSignal.notify_all();
+
+    for (auto &worker : poolWorkers) worker.join();
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    poolWorkers.clear();
+    poolWorkerCount = -1;
+}
+
+int32 RSDK::GetThreadPoolWorkerCount()
+{
+    if (poolWorkerCount == -1)
+        InitThreadPool();
+
+    return poolWorkerCount;
+}
+
+void RSDK::RunJob(JobGroup *group, JobCallback job)
+{
+    if (!GetThreadPoolWorkerCount()) {
+        job();
+        return;
+    }
+
+    if (group)
+        group->pending++;
+
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        poolJobs.push_back({ group, std::move(job) });
+    }
+    poolSignal.notify_one();
+}
+
+bool32 RSDK::RunPendingJob(JobGroup *group)
+{
+    PoolJob job;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+
+        // jobs from other groups are left for the workers, they could be something slow (like a file write) the caller shouldn't stall on
+        auto queued = poolJobs.begin();
+        while (queued != poolJobs.end() && queued->group != group) ++queued;
+
+        if (queued == poolJobs.end())
+            return false;
+
+        job = std::move(*queued);
+        poolJobs.erase(queued);
+    }
+
+    job.callback();
+    if (job.group)
+        job.group->pending--;
+
+    return true;
+}
+
+void RSDK::WaitForJobGroup(JobGroup *group)
+{
+    while (!JobGroupFinished(group)) {
+        if (!RunPendingJob(group))
+            std::this_thread::yield();
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <functional>
+
+namespace RSDK
+{
+
+#define THREADPOOL_WORKER_MAX (8)
+
+typedef std::function<void()> JobCallback;
+
+// a set of jobs that can be waited on together
+struct JobGroup {
+    std::atomic<int32> pending{ 0 };
+};
+
+// workers are started on the first RunJob call, so this only needs to be called to warm the pool up early
+void InitThreadPool();
+void ReleaseThreadPool();
+int32 GetThreadPoolWorkerCount();
+
+// queues a job onto the pool, if there's no workers to run it (single core devices) it runs immediately instead
+void RunJob(JobGroup *group, JobCallback job);
+// pops a single queued job from group & runs it on the calling thread, returns false if there wasn't one
+bool32 RunPendingJob(JobGroup *group);
+
+inline bool32 JobGroupFinished(JobGroup *group) { return group->pending.load() == 0; }
+// helps out with the group's own queued jobs until everything in it has finished, jobs from other groups are never picked up
+void WaitForJobGroup(JobGroup *group);
+
+} // namespace RSDK
+
+#endif // !THREADPOOL_H
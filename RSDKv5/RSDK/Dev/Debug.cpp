@@ -12,11 +12,27 @@
 std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
 #endif
 
+#if !RETRO_USE_ORIGINAL_CODE
+#include <mutex>
+#endif
+#if !RETRO_USE_ORIGINAL_CODE && RETRO_PLATFORM != RETRO_ANDROID
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <cstdlib>
+#endif
+
 using namespace RSDK;
 
+#include "RenderBench.cpp"
+
 bool32 RSDK::engineDebugMode = true;
 bool32 RSDK::useEndLine      = true;
 char RSDK::outputString[0x400];
+#if !RETRO_USE_ORIGINAL_CODE
+std::mutex outputStringMutex; // PrintLog can be called from any thread
+#endif
 
 #if RETRO_REV02
 int32 RSDK::viewableVarCount = 0;
@@ -27,20 +43,207 @@ DevMenu RSDK::devMenu = DevMenu();
 
 inline void PrintConsole(const char *message) { printf("%s", message); }
 
+#if !RETRO_USE_ORIGINAL_CODE && RETRO_PLATFORM != RETRO_ANDROID
+// log.txt writes go through a ring of lines that any thread can push onto without locking,
+// a background thread drains it into a log file that stays open & gets flushed every so often
+#define LOG_RING_SIZE        (0x100) // must be a power of 2
+#define LOG_FLUSH_INTERVAL   (100)   // in ms
+#define LOG_RING_WAKE_AMOUNT (LOG_RING_SIZE / 2)
+
+struct LogRingEntry {
+    std::atomic<uint32> sequence;
+    int32 length;
+    char text[0x400];
+};
+
+LogRingEntry logRing[LOG_RING_SIZE];
+std::atomic<uint32> logWritePos{ 0 };
+std::atomic<uint32> logReadPos{ 0 }; // only advanced with logFileMutex held, but PushLogLine reads it to decide when to wake the writer
+
+std::mutex logFileMutex; // only ever taken by whoever is draining the ring, never when pushing onto it
+FILE *logFile = NULL;
+char logFilePath[0x100];
+
+std::mutex logWriterMutex;
+std::condition_variable logWriterSignal;
+std::thread logWriterThread;
+std::atomic<bool> logWriterActive{ false };
+
+inline int32 GetLogSeverity(int32 mode)
+{
+    switch (mode) {
+        default:
+        case PRINT_NORMAL: return 0;
+        case PRINT_POPUP: return 1;
+        case PRINT_ERROR:
+#if RETRO_REV0U
+        case PRINT_SCRIPTERR:
+#endif
+            return 2;
+        case PRINT_FATAL: return 3;
+    }
+}
+
+// must be called with logFileMutex held
+void DrainLogRing()
+{
+    // the user dir can be set after the first few lines get logged, so make sure we're writing to the right place
+    char path[0x100];
+    sprintf_s(path, sizeof(path), "%slog.txt", SKU::userFileDir);
+    if (!logFile || strcmp(path, logFilePath) != 0) {
+        if (logFile)
+            fclose(logFile);
+
+        strcpy(logFilePath, path);
+        logFile = fopen(logFilePath, "a");
+    }
+
+    uint32 readPos = logReadPos.load(std::memory_order_relaxed);
+    while (true) {
+        LogRingEntry *entry = &logRing[readPos & (LOG_RING_SIZE - 1)];
+        if (entry->sequence.load(std::memory_order_acquire) != readPos + 1)
+            break;
+
+        if (logFile)
+            fwrite(entry->text, 1, entry->length, logFile);
+
+        entry->sequence.store(readPos + LOG_RING_SIZE, std::memory_order_release);
+        logReadPos.store(++readPos, std::memory_order_relaxed);
+    }
+}
+
+void LogWriterLoop()
+{
+    while (logWriterActive) {
+        {
+            std::unique_lock<std::mutex> lock(logWriterMutex);
+            logWriterSignal.wait_for(lock, std::chrono::milliseconds(LOG_FLUSH_INTERVAL));
+        }
+
+        std::lock_guard<std::mutex> lock(logFileMutex);
+        DrainLogRing();
+        if (logFile)
+            fflush(logFile);
+    }
+}
+
+void StartLogWriter()
+{
+    static std::mutex startMutex;
+    static bool32 initializedRing = false;
+
+    std::lock_guard<std::mutex> lock(startMutex);
+    if (logWriterActive)
+        return;
+
+    if (!initializedRing) {
+        for (uint32 i = 0; i < LOG_RING_SIZE; ++i) logRing[i].sequence.store(i, std::memory_order_relaxed);
+
+        // there's no crash handler, nothing the writer does is safe to do from a signal handler & the platform may have its own
+        // lines pushed right before a crash can be lost, which is why PRINT_FATAL flushes straight away
+        std::atexit(ReleaseLog);
+        initializedRing = true;
+    }
+
+    logWriterActive = true;
+    logWriterThread = std::thread(LogWriterLoop);
+}
+
+void PushLogLine(const char *text, int32 length)
+{
+    if (!logWriterActive)
+        StartLogWriter();
+
+    uint32 pos          = logWritePos.load(std::memory_order_relaxed);
+    LogRingEntry *entry = NULL;
+    while (true) {
+        entry        = &logRing[pos & (LOG_RING_SIZE - 1)];
+        int32 offset = (int32)(entry->sequence.load(std::memory_order_acquire) - pos);
+
+        if (offset == 0) {
+            if (logWritePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (offset < 0) {
+            // the ring's full, so help drain it if the writer isn't already on it
+            if (logFileMutex.try_lock()) {
+                DrainLogRing();
+                logFileMutex.unlock();
+            }
+            else {
+                std::this_thread::yield();
+            }
+
+            pos = logWritePos.load(std::memory_order_relaxed);
+        }
+        else {
+            pos = logWritePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    memcpy(entry->text, text, length);
+    entry->length = length;
+    entry->sequence.store(pos + 1, std::memory_order_release);
+
+    if (pos - logReadPos.load(std::memory_order_relaxed) >= LOG_RING_WAKE_AMOUNT)
+        logWriterSignal.notify_one();
+}
+
+void RSDK::FlushLog()
+{
+    std::lock_guard<std::mutex> lock(logFileMutex);
+    DrainLogRing();
+    if (logFile)
+        fflush(logFile);
+}
+
+void RSDK::ReleaseLog()
+{
+    if (logWriterActive) {
+        logWriterActive = false;
+        logWriterSignal.notify_one();
+    }
+
+    if (logWriterThread.joinable())
+        logWriterThread.join();
+
+    std::lock_guard<std::mutex> lock(logFileMutex);
+    DrainLogRing();
+    if (logFile)
+        fclose(logFile);
+    logFile = NULL;
+}
+#else
+void RSDK::FlushLog() {}
+void RSDK::ReleaseLog() {}
+#endif
+
 void RSDK::PrintLog(int32 mode, const char *message, ...)
 {
 #ifndef RETRO_DISABLE_LOG
     if (engineDebugMode) {
-        // make the full string
+        // make the full string, done in a local buffer since this can be called from any thread
+        char logString[sizeof(outputString)];
+
         va_list args;
         va_start(args, message);
+        int32 length = vsnprintf(logString, sizeof(logString) - 1, message, args);
+        va_end(args);
 
-        vsnprintf(outputString, sizeof(outputString), message, args);
+        length = CLAMP(length, 0, (int32)sizeof(logString) - 2);
         if (useEndLine)
-            sprintf(outputString, "%.*s\n", (int32)sizeof(outputString) - 1, outputString);
-        else
-            sprintf(outputString, "%.*s", (int32)sizeof(outputString) - 1, outputString);
-        va_end(args);
+            logString[length++] = '\n';
+        logString[length] = 0;
+
+        // kept around for the error screens
+#if !RETRO_USE_ORIGINAL_CODE
+        {
+            std::lock_guard<std::mutex> lock(outputStringMutex);
+            memcpy(outputString, logString, length + 1);
+        }
+#else
+        memcpy(outputString, logString, length + 1);
+#endif
 
 #if RETRO_REV02
         switch (mode) {
@@ -49,7 +252,7 @@ void RSDK::PrintLog(int32 mode, const char *message, ...)
 
             case PRINT_POPUP:
                 if (sceneInfo.state & 3) {
-                    CreateEntity(DevOutput->classID, outputString, 0, 0);
+                    CreateEntity(DevOutput->classID, logString, 0, 0);
                 }
                 break;
 
@@ -71,17 +274,17 @@ void RSDK::PrintLog(int32 mode, const char *message, ...)
             case PRINT_SCRIPTERR:
                 engine.storedState     = RSDK::Legacy::gameMode;
                 RSDK::Legacy::gameMode = RSDK::Legacy::ENGINE_SCRIPTERROR;
-                strcpy(RSDK::Legacy::scriptErrorMessage, outputString);
+                strcpy(RSDK::Legacy::scriptErrorMessage, logString);
                 break;
 #endif
         }
 #endif
         if (engine.consoleEnabled) {
-            PrintConsole(outputString);
+            PrintConsole(logString);
         }
         else {
 #if RETRO_PLATFORM == RETRO_WIN
-            OutputDebugStringA(outputString);
+            OutputDebugStringA(logString);
 #elif RETRO_PLATFORM == RETRO_ANDROID
             int32 as = ANDROID_LOG_INFO;
             switch (mode) {
@@ -93,28 +296,36 @@ void RSDK::PrintLog(int32 mode, const char *message, ...)
                 default: break;
             }
             auto *jni        = GetJNISetup();
-            int len          = strlen(outputString);
+            int len          = length;
             jbyteArray array = jni->env->NewByteArray(len); // as per research, this gets freed automatically
-            jni->env->SetByteArrayRegion(array, 0, len, (jbyte *)outputString);
+            jni->env->SetByteArrayRegion(array, 0, len, (jbyte *)logString);
             jni->env->CallVoidMethod(jni->thiz, writeLog, array, as);
 #elif RETRO_PLATFORM == RETRO_SWITCH
-            printf("%s", outputString);
+            printf("%s", logString);
 #endif
         }
 
 #if !RETRO_USE_ORIGINAL_CODE && RETRO_PLATFORM != RETRO_ANDROID
-        char logPath[0x100];
-        sprintf_s(logPath, sizeof(logPath), "%slog.txt", SKU::userFileDir);
-        FileIO *file = fOpen(logPath, "a");
-        if (file) {
-            fWrite(&outputString, 1, strlen(outputString), file);
-            fClose(file);
+        if (GetLogSeverity(mode) >= customSettings.fileLogLevel) {
+            PushLogLine(logString, length);
+
+            // make sure it's on disk before things go south
+            if (mode == PRINT_FATAL)
+                FlushLog();
         }
 #endif
     }
 #endif
 }
 
+void RSDK::CopyOutputString(char *buffer)
+{
+#if !RETRO_USE_ORIGINAL_CODE
+    std::lock_guard<std::mutex> lock(outputStringMutex);
+#endif
+    memcpy(buffer, outputString, sizeof(outputString));
+}
+
 #if RETRO_REV02
 void RSDK::AddViewableVariable(const char *name, void *value, int32 type, int32 min, int32 max)
 {
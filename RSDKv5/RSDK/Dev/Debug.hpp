@@ -34,6 +34,12 @@ extern bool32 useEndLine;
 extern char outputString[0x400];
 
 void PrintLog(int32 mode, const char *message, ...);
+// outputString can be written by any thread that logs, so it should be read through this (buffer must be sizeof(outputString))
+void CopyOutputString(char *buffer);
+// forces any buffered log.txt lines out to disk
+void FlushLog();
+// stops the log writer & closes log.txt
+void ReleaseLog();
 
 #if !RETRO_REV02
 enum PrintMessageTypes {
@@ -0,0 +1,624 @@
+#include <chrono>
+
+char RSDK::renderBenchGoldens[0x100];
+bool32 RSDK::renderBenchUpdate = false;
+
+#define RENDERBENCH_WORKLOAD_COUNT (0x80)
+#define RENDERBENCH_ITERATIONS     (0x40)
+#define RENDERBENCH_SEED           (0x5EED)
+
+struct RenderBenchResult {
+    char name[0x20];
+    uint64 hash;
+};
+
+RenderBenchResult benchGoldens[RENDERBENCH_WORKLOAD_COUNT];
+RenderBenchResult benchResults[RENDERBENCH_WORKLOAD_COUNT];
+int32 benchGoldenCount = 0;
+int32 benchResultCount = 0;
+int32 benchFailures    = 0;
+
+uint32 benchSeed          = RENDERBENCH_SEED;
+uint16 benchSheetID       = 0;
+uint16 benchModelID       = 0;
+uint16 benchSceneID       = 0;
+bool32 benchOwnsScanlines = false;
+uint16 benchTintTable[0x10000];
+
+const char *benchInkNames[] = { "none", "blend", "alpha", "add", "sub", "tint", "masked", "unmasked" };
+
+// plain LCG, reseeded before every pass so each pass of a workload draws exactly the same thing
+inline uint32 BenchRand()
+{
+    benchSeed = benchSeed * 1103515245 + 12345;
+    return (benchSeed >> 16) & 0x7FFF;
+}
+
+// checkerboard of the mask colour over a gradient, so the blending & masked inks all have something to work with
+inline uint16 GetBenchBackdrop(int32 x, int32 y)
+{
+    if (((x >> 4) ^ (y >> 4)) & 1)
+        return maskColor;
+
+    return ((x >> 3) & 0x1F) | (((y >> 2) & 0x3F) << 5) | ((((x + y) >> 4) & 0x1F) << 11);
+}
+
+void ResetBenchScreen()
+{
+    currentScreen             = &screens[0];
+    currentScreen->position.x = 0;
+    currentScreen->position.y = 0;
+    SetClipBounds(0, 0, 0, currentScreen->size.x, currentScreen->size.y);
+    drawRecording = false;
+
+    for (int32 y = 0; y < currentScreen->size.y; ++y) {
+        uint16 *frameBuffer = &currentScreen->frameBuffer[y * currentScreen->pitch];
+        for (int32 x = 0; x < currentScreen->pitch; ++x) frameBuffer[x] = GetBenchBackdrop(x, y);
+    }
+}
+
+// 64-bit FNV-1a over the visible part of each line
+uint64 HashBenchScreen()
+{
+    uint64 hash = 0xCBF29CE484222325ULL;
+    for (int32 y = 0; y < currentScreen->size.y; ++y) {
+        uint16 *frameBuffer = &currentScreen->frameBuffer[y * currentScreen->pitch];
+        for (int32 x = 0; x < currentScreen->size.x; ++x) {
+            hash = (hash ^ (frameBuffer[x] & 0xFF)) * 0x100000001B3ULL;
+            hash = (hash ^ (frameBuffer[x] >> 8)) * 0x100000001B3ULL;
+        }
+    }
+
+    return hash;
+}
+
+// used for workloads that can't easily say how many pixels they drew (layers, 3D), counts what changed from the backdrop
+int32 CountBenchCoverage()
+{
+    int32 count = 0;
+    for (int32 y = 0; y < currentScreen->size.y; ++y) {
+        uint16 *frameBuffer = &currentScreen->frameBuffer[y * currentScreen->pitch];
+        for (int32 x = 0; x < currentScreen->size.x; ++x) count += frameBuffer[x] != GetBenchBackdrop(x, y);
+    }
+
+    return count;
+}
+
+bool32 LoadBenchGoldens()
+{
+    FileIO *file = fOpen(renderBenchGoldens, "rb");
+    if (!file)
+        return false;
+
+    char buffer[0x2000];
+    int32 size   = (int32)fRead(buffer, 1, sizeof(buffer) - 1, file);
+    buffer[size] = 0;
+    fClose(file);
+
+    benchGoldenCount = 0;
+    char *line       = buffer;
+    while (*line && benchGoldenCount < RENDERBENCH_WORKLOAD_COUNT) {
+        RenderBenchResult *golden = &benchGoldens[benchGoldenCount];
+        if (sscanf(line, "%31s %llx", golden->name, &golden->hash) == 2)
+            ++benchGoldenCount;
+
+        while (*line && *line != '\n') ++line;
+        while (*line == '\n' || *line == '\r') ++line;
+    }
+
+    return true;
+}
+
+bool32 SaveBenchGoldens()
+{
+    FileIO *file = fOpen(renderBenchGoldens, "wb");
+    if (!file) {
+        PrintLog(PRINT_NORMAL, "RenderBench: couldn't write goldens to %s", renderBenchGoldens);
+        return false;
+    }
+
+    for (int32 r = 0; r < benchResultCount; ++r) {
+        char line[0x40];
+        int32 length = sprintf(line, "%s %016llx\n", benchResults[r].name, benchResults[r].hash);
+        fWrite(line, 1, length, file);
+    }
+    fClose(file);
+
+    PrintLog(PRINT_NORMAL, "RenderBench: recorded %d goldens to %s", benchResultCount, renderBenchGoldens);
+    return true;
+}
+
+// draws one pass from a fresh backdrop & hashes it, then times a batch of passes drawn over the top of it
+// draw returns roughly how many pixels a pass covers, or 0 to have them counted from the first pass instead
+uint64 RunBenchWorkload(const char *name, int32 (*draw)(int32 param), int32 param)
+{
+    ResetBenchScreen();
+    benchSeed    = RENDERBENCH_SEED;
+    int32 pixels = draw(param);
+    uint64 hash  = HashBenchScreen();
+    if (!pixels)
+        pixels = CountBenchCoverage();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int32 i = 0; i < RENDERBENCH_ITERATIONS; ++i) {
+        benchSeed = RENDERBENCH_SEED;
+        draw(param);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    double mpps    = seconds > 0.0 ? (double)pixels * RENDERBENCH_ITERATIONS / seconds / 1000000.0 : 0.0;
+
+    const char *status = "recorded";
+    if (!renderBenchUpdate) {
+        status = "missing";
+        for (int32 g = 0; g < benchGoldenCount; ++g) {
+            if (!strcmp(benchGoldens[g].name, name)) {
+                status = benchGoldens[g].hash == hash ? "ok" : "MISMATCH";
+                break;
+            }
+        }
+
+        if (strcmp(status, "ok"))
+            ++benchFailures;
+    }
+
+    if (benchResultCount < RENDERBENCH_WORKLOAD_COUNT) {
+        RenderBenchResult *result = &benchResults[benchResultCount++];
+        strncpy(result->name, name, sizeof(result->name) - 1);
+        result->name[sizeof(result->name) - 1] = 0;
+        result->hash                           = hash;
+    }
+
+    PrintLog(PRINT_NORMAL, "%-24s %016llx %9.2f Mpx/s  %s", name, hash, mpps, status);
+    return hash;
+}
+
+bool32 SetupBenchData()
+{
+    CalculateTrigAngles();
+    GenerateBlendLookupTable();
+
+    SetScreenSize(0, 424, SCREEN_YSIZE);
+    currentScreen = &screens[0];
+
+    // a different ramp per bank, with the banks swapping every 32 lines like a water line would
+    for (int32 b = 0; b < PALETTE_BANK_COUNT; ++b) {
+        for (int32 c = 0; c < PALETTE_BANK_SIZE; ++c)
+            fullPalette[b][c] = ((c * 7 + b * 31) & 0x1F) | (((c * 3 + b * 11) & 0x3F) << 5) | (((c ^ (b << 4)) & 0x1F) << 11);
+    }
+    for (int32 l = 0; l < SCREEN_YSIZE; ++l) gfxLineBuffer[l] = (l >> 5) & 1;
+
+    maskColor = 0xF81F;
+    for (int32 c = 0; c < 0x10000; ++c) benchTintTable[c] = (c >> 1) & 0x7BEF;
+#if RETRO_REV02
+    SetTintLookupTable(benchTintTable);
+#else
+    memcpy(tintLookupTable, benchTintTable, sizeof(benchTintTable));
+#endif
+
+    // a 256x256 sheet of round blobs with transparent gaps between them, so the run tables get built & used
+    for (benchSheetID = 0; benchSheetID < SURFACE_COUNT; ++benchSheetID) {
+        if (gfxSurface[benchSheetID].scope == SCOPE_NONE)
+            break;
+    }
+    if (benchSheetID >= SURFACE_COUNT)
+        return false;
+
+    GFXSurface *surface = &gfxSurface[benchSheetID];
+    GEN_HASH_MD5("RenderBench", surface->hash);
+    surface->scope    = SCOPE_STAGE;
+    surface->width    = 0x100;
+    surface->height   = 0x100;
+    surface->lineSize = 8;
+    surface->pixels   = NULL;
+    surface->runTable = NULL;
+    AllocateStorage((void **)&surface->pixels, surface->width * surface->height, DATASET_STG, false);
+    for (int32 y = 0; y < surface->height; ++y) {
+        for (int32 x = 0; x < surface->width; ++x) {
+            int32 dx = (x & 0x1F) - 0x10;
+            int32 dy = (y & 0x1F) - 0x10;
+
+            uint8 index = 0;
+            if (dx * dx + dy * dy < 0xC0)
+                index = 1 + ((x * 3 + y * 5) % 0xFF);
+            surface->pixels[(y << surface->lineSize) + x] = index;
+        }
+    }
+    BuildSurfaceRuns(surface);
+
+    // tiles & a 64x32 tile layer with a few parallax rows, some of them deformed
+    benchSeed = RENDERBENCH_SEED;
+    for (int32 p = 0; p < TILESET_SIZE * 4; ++p) tilesetPixels[p] = (BenchRand() & 7) ? (uint8)BenchRand() : 0;
+
+    TileLayer *layer       = &tileLayers[0];
+    layer->xsize           = 64;
+    layer->ysize           = 32;
+    layer->widthShift      = 6;
+    layer->heightShift     = 5;
+    layer->parallaxFactor  = 0x100;
+    layer->scrollSpeed     = 0;
+    layer->scrollPos       = 0;
+    layer->scrollInfoCount = 4;
+    layer->layout          = NULL;
+    layer->lineScroll      = NULL;
+    AllocateStorage((void **)&layer->layout, sizeof(uint16) << (layer->widthShift + layer->heightShift), DATASET_STG, false);
+    AllocateStorage((void **)&layer->lineScroll, TILE_SIZE * layer->xsize, DATASET_STG, false);
+    for (int32 t = 0; t < (1 << (layer->widthShift + layer->heightShift)); ++t) layer->layout[t] = (BenchRand() & 7) ? (BenchRand() & 0xFFF) : 0xFFFF;
+    for (int32 l = 0; l < TILE_SIZE * layer->xsize; ++l) layer->lineScroll[l] = (l >> 5) & 3;
+
+    for (int32 s = 0; s < layer->scrollInfoCount; ++s) {
+        layer->scrollInfo[s].parallaxFactor = 0x100 - 0x30 * s;
+        layer->scrollInfo[s].scrollSpeed    = 0;
+        layer->scrollInfo[s].scrollPos      = 0;
+        layer->scrollInfo[s].tilePos        = 0;
+        layer->scrollInfo[s].deform         = s & 1;
+    }
+
+    for (int32 d = 0; d < 0x400; ++d) {
+        layer->deformationData[d]  = Sin512(d * 8) >> 7;
+        layer->deformationDataW[d] = Sin512(d * 16) >> 6;
+    }
+    layer->deformationOffset  = 0;
+    layer->deformationOffsetW = 0;
+    layer->scanlineCallback   = NULL;
+
+    if (!scanlines) {
+        scanlines          = (ScanlineInfo *)malloc(SCREEN_XMAX * sizeof(ScanlineInfo));
+        benchOwnsScanlines = true;
+        memset(scanlines, 0, SCREEN_XMAX * sizeof(ScanlineInfo));
+    }
+
+    // a cube with flat normals (so 4 verts per face) for the 3D scenes
+    for (benchModelID = 0; benchModelID < MODEL_COUNT; ++benchModelID) {
+        if (modelList[benchModelID].scope == SCOPE_NONE)
+            break;
+    }
+    if (benchModelID >= MODEL_COUNT)
+        return false;
+
+    const int8 cubeFaces[6][4][3] = {
+        { { -1, -1, 1 }, { 1, -1, 1 }, { 1, 1, 1 }, { -1, 1, 1 } },     // +z
+        { { 1, -1, -1 }, { -1, -1, -1 }, { -1, 1, -1 }, { 1, 1, -1 } }, // -z
+        { { 1, -1, 1 }, { 1, -1, -1 }, { 1, 1, -1 }, { 1, 1, 1 } },     // +x
+        { { -1, -1, -1 }, { -1, -1, 1 }, { -1, 1, 1 }, { -1, 1, -1 } }, // -x
+        { { -1, 1, 1 }, { 1, 1, 1 }, { 1, 1, -1 }, { -1, 1, -1 } },     // +y
+        { { -1, -1, -1 }, { 1, -1, -1 }, { 1, -1, 1 }, { -1, -1, 1 } }, // -y
+    };
+    const int8 cubeNormals[6][3] = { { 0, 0, 1 }, { 0, 0, -1 }, { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 } };
+
+    Model *model = &modelList[benchModelID];
+    GEN_HASH_MD5("RenderBench", model->hash);
+    model->scope         = SCOPE_STAGE;
+    model->flags         = MODEL_USENORMALS;
+    model->faceVertCount = 4;
+    model->vertCount     = 6 * 4;
+    model->frameCount    = 1;
+    model->indexCount    = 6 * 4;
+    model->vertices      = NULL;
+    model->indices       = NULL;
+    model->texCoords     = NULL;
+    model->colors        = NULL;
+    AllocateStorage((void **)&model->vertices, sizeof(ModelVertex) * model->vertCount, DATASET_STG, true);
+    AllocateStorage((void **)&model->indices, sizeof(uint16) * model->indexCount, DATASET_STG, true);
+
+    for (int32 f = 0; f < 6; ++f) {
+        for (int32 v = 0; v < 4; ++v) {
+            ModelVertex *vertex = &model->vertices[f * 4 + v];
+            vertex->x           = cubeFaces[f][v][0] * 0x800;
+            vertex->y           = cubeFaces[f][v][1] * 0x800;
+            vertex->z           = cubeFaces[f][v][2] * 0x800;
+            vertex->nx          = cubeNormals[f][0] * 0x10000;
+            vertex->ny          = cubeNormals[f][1] * 0x10000;
+            vertex->nz          = cubeNormals[f][2] * 0x10000;
+
+            model->indices[f * 4 + v] = f * 4 + v;
+        }
+    }
+
+    benchSceneID = Create3DScene("RenderBench", 0x1000, SCOPE_STAGE);
+    if (benchSceneID >= SCENE3D_COUNT)
+        return false;
+
+    SetDiffuseColor(benchSceneID, 0xA0, 0xA0, 0xA0);
+    SetDiffuseIntensity(benchSceneID, 8, 8, 8);
+    SetSpecularIntensity(benchSceneID, 0x0F, 0x0F, 0x0F);
+
+    return true;
+}
+
+// Workloads
+
+int32 BenchSprites(int32 inkEffect)
+{
+    for (int32 s = 0; s < 0x60; ++s) {
+        int32 x = (int32)(BenchRand() % (currentScreen->size.x + 0x30)) - 0x30;
+        int32 y = (int32)(BenchRand() % (currentScreen->size.y + 0x30)) - 0x30;
+        DrawSpriteFlipped(x, y, 0x30, 0x30, (BenchRand() & 3) << 6, (BenchRand() & 3) << 6, BenchRand() & 3, inkEffect, 0xA0, benchSheetID);
+    }
+
+    return 0x60 * 0x30 * 0x30;
+}
+
+int32 BenchRotozoom(int32 inkEffect)
+{
+    int32 pixels = 0;
+    for (int32 s = 0; s < 0x20; ++s) {
+        int32 x     = BenchRand() % currentScreen->size.x;
+        int32 y     = BenchRand() % currentScreen->size.y;
+        int32 scale = 0x100 + (BenchRand() & 0x2FF);
+        DrawSpriteRotozoom(x, y, -0x20, -0x20, 0x40, 0x40, (BenchRand() & 3) << 6, 0, scale, scale, BenchRand() & 1, BenchRand() & 0x1FF, inkEffect,
+                           0xA0, benchSheetID);
+
+        pixels += (0x40 * scale >> 9) * (0x40 * scale >> 9);
+    }
+
+    return pixels;
+}
+
+int32 BenchDeformed(int32 inkEffect)
+{
+    for (int32 y = 0; y < currentScreen->size.y; ++y) {
+        scanlines[y].position.x = TO_FIXED(Sin512(y * 4) >> 4);
+        scanlines[y].position.y = TO_FIXED(y);
+        scanlines[y].deform.x   = 0x10000 + (Cos512(y * 2) << 5);
+        scanlines[y].deform.y   = Sin512(y * 8) << 3;
+    }
+
+    DrawDeformedSprite(benchSheetID, inkEffect, 0xA0);
+    return currentScreen->size.x * currentScreen->size.y;
+}
+
+int32 BenchLayer(int32 type)
+{
+    TileLayer *layer            = &tileLayers[0];
+    layer->type                 = type;
+    layer->deformationOffset    = 0x10;
+    currentScreen->position.x   = 0x123;
+    currentScreen->position.y   = 0x45;
+    currentScreen->waterDrawPos = currentScreen->size.y - 0x40;
+    ProcessParallax(layer);
+
+    switch (type) {
+        default: break;
+        case LAYER_HSCROLL: DrawLayerHScroll(layer); break;
+        case LAYER_VSCROLL: DrawLayerVScroll(layer); break;
+        case LAYER_BASIC: DrawLayerBasic(layer); break;
+
+        case LAYER_ROTOZOOM: {
+            // ProcessParallax only sets up a flat plane, so tilt it into something more like a mode 7 floor
+            for (int32 y = 0; y < currentScreen->size.y; ++y) {
+                int32 zoom              = 0x10000 + (y << 9);
+                scanlines[y].deform.x   = zoom * Cos512(0x20) >> 9;
+                scanlines[y].deform.y   = zoom * Sin512(0x20) >> 9;
+                scanlines[y].position.x = TO_FIXED(0x80) - scanlines[y].deform.x * currentScreen->center.x;
+                scanlines[y].position.y = TO_FIXED(0x80 + y);
+            }
+
+            DrawLayerRotozoom(layer);
+            break;
+        }
+    }
+
+    currentScreen->position.x   = 0;
+    currentScreen->position.y   = 0;
+    currentScreen->waterDrawPos = currentScreen->size.y;
+    return currentScreen->size.x * currentScreen->size.y;
+}
+
+int32 BenchCircles(int32 inkEffect)
+{
+    int32 pixels = 0;
+    for (int32 c = 0; c < 0x18; ++c) {
+        int32 radius = 8 + (BenchRand() & 0x3F);
+        DrawCircle(BenchRand() % currentScreen->size.x, BenchRand() % currentScreen->size.y, radius, 0x40A0E0 + (c << 3), 0xA0, inkEffect, true);
+        pixels += 3 * radius * radius;
+    }
+
+    return pixels;
+}
+
+int32 BenchRings(int32 inkEffect)
+{
+    int32 pixels = 0;
+    for (int32 c = 0; c < 0x18; ++c) {
+        int32 outer = 0x10 + (BenchRand() & 0x3F);
+        int32 inner = outer - 4 - (BenchRand() & 0xF);
+        DrawCircleOutline(BenchRand() % currentScreen->size.x, BenchRand() % currentScreen->size.y, inner, outer, 0xE0A040 + (c << 3), 0xA0, inkEffect,
+                          true);
+        pixels += 3 * (outer * outer - inner * inner);
+    }
+
+    return pixels;
+}
+
+// rotated rects, so they're always convex
+void GetBenchQuad(Vector2 *vertices, int32 *area)
+{
+    int32 x      = TO_FIXED(BenchRand() % currentScreen->size.x);
+    int32 y      = TO_FIXED(BenchRand() % currentScreen->size.y);
+    int32 w      = 8 + (BenchRand() & 0x3F);
+    int32 h      = 8 + (BenchRand() & 0x3F);
+    int32 angle  = BenchRand() & 0x1FF;
+    int32 sine   = Sin512(angle);
+    int32 cosine = Cos512(angle);
+
+    const int32 corners[4][2] = { { -1, -1 }, { 1, -1 }, { 1, 1 }, { -1, 1 } };
+    for (int32 v = 0; v < 4; ++v) {
+        int32 dx      = corners[v][0] * w;
+        int32 dy      = corners[v][1] * h;
+        vertices[v].x = x + ((dx * cosine - dy * sine) << 7);
+        vertices[v].y = y + ((dx * sine + dy * cosine) << 7);
+    }
+
+    *area += 4 * w * h;
+}
+
+int32 BenchFaces(int32 inkEffect)
+{
+    int32 pixels = 0;
+    Vector2 vertices[4];
+    for (int32 f = 0; f < 0x30; ++f) {
+        GetBenchQuad(vertices, &pixels);
+        DrawFace(vertices, 4, 0x40 + f, 0xA0, 0xE0 - f, 0xA0, inkEffect);
+    }
+
+    return pixels;
+}
+
+int32 BenchBlendedFaces(int32 inkEffect)
+{
+    int32 pixels = 0;
+    Vector2 vertices[4];
+    uint32 colors[4] = { 0xFF0000, 0x00FF00, 0x0000FF, 0xFFFFFF };
+    for (int32 f = 0; f < 0x30; ++f) {
+        GetBenchQuad(vertices, &pixels);
+        DrawBlendedFace(vertices, colors, 4, 0xA0, inkEffect);
+    }
+
+    return pixels;
+}
+
+int32 BenchRectangles(int32 inkEffect)
+{
+    int32 pixels = 0;
+    for (int32 r = 0; r < 0x30; ++r) {
+        int32 w = 8 + (BenchRand() & 0x7F);
+        int32 h = 8 + (BenchRand() & 0x3F);
+        DrawRectangle(BenchRand() % currentScreen->size.x, BenchRand() % currentScreen->size.y, w, h, 0x20C080 + r, 0xA0, inkEffect, true);
+        pixels += w * h;
+    }
+
+    return pixels;
+}
+
+int32 BenchScene3D(int32 drawMode)
+{
+    // Draw3DScene takes its ink & alpha from whatever entity is being drawn
+    Entity *storeEntity = sceneInfo.entity;
+    Entity entity;
+    memset(&entity, 0, sizeof(entity));
+    entity.alpha     = 0xC0;
+    entity.inkEffect = drawMode == S3D_SOLIDCOLOR_SHADED_BLENDED_SCREEN ? INK_ALPHA : INK_NONE;
+    sceneInfo.entity = &entity;
+
+    Prepare3DScene(benchSceneID);
+
+    Matrix matWorld, matNormals;
+    for (int32 c = 0; c < 0x40; ++c) {
+        MatrixRotateXYZ(&matNormals, BenchRand() & 0x3FF, BenchRand() & 0x3FF, BenchRand() & 0x3FF);
+        MatrixCopy(&matWorld, &matNormals);
+        MatrixTranslateXYZ(&matWorld, TO_FIXED((c & 3) * 0x18 - 0x24), TO_FIXED(((c >> 2) & 3) * 0x10 - 0x18), TO_FIXED(0x40 + (c >> 4) * 0x18), false);
+        AddModelToScene(benchModelID, benchSceneID, drawMode, &matWorld, &matNormals, 0x4080C0 + (c << 10));
+    }
+
+    Draw3DScene(benchSceneID);
+
+    sceneInfo.entity = storeEntity;
+    return 0;
+}
+
+// the same scene with the clip rect pulled in through the middle of it, so faces get cut off partway through a line & a tile
+int32 BenchClippedScene3D(int32 drawMode)
+{
+    SetClipBounds(0, currentScreen->center.x - 0x4D, currentScreen->center.y - 0x2B, currentScreen->center.x + 0x47, currentScreen->center.y + 0x25);
+    return BenchScene3D(drawMode);
+}
+
+// sprites & rects overlapping in painter's order, drawn either straight away or through the deferred command buffer
+int32 BenchMixed(int32 deferred)
+{
+    drawRecording = deferred;
+
+    int32 pixels = 0;
+    for (int32 i = 0; i < 4; ++i) {
+        pixels += BenchSprites(i & 1 ? INK_ALPHA : INK_NONE);
+        pixels += BenchRectangles(i & 1 ? INK_NONE : INK_ADD);
+    }
+
+    if (deferred)
+        FlushDrawCommands();
+
+    drawRecording = false;
+    return pixels;
+}
+
+int32 RSDK::RunRenderBench()
+{
+    if (!InitStorage() || !SetupBenchData()) {
+        PrintLog(PRINT_NORMAL, "RenderBench: failed to set up the bench data");
+        ReleaseStorage();
+        return 1;
+    }
+
+    // a missing goldens file fails the run, they only ever get (re)written when asked for with "renderbenchupdate=<path>"
+    if (!renderBenchUpdate && !LoadBenchGoldens()) {
+        PrintLog(PRINT_NORMAL, "RenderBench: no goldens at %s, use renderbenchupdate=<path> to record them", renderBenchGoldens);
+        ++benchFailures;
+    }
+
+    char name[0x20];
+    for (int32 i = INK_NONE; i <= INK_UNMASKED; ++i) {
+        sprintf(name, "sprite_%s", benchInkNames[i]);
+        RunBenchWorkload(name, BenchSprites, i);
+    }
+
+    for (int32 i = INK_NONE; i <= INK_UNMASKED; ++i) {
+        sprintf(name, "rotozoom_%s", benchInkNames[i]);
+        RunBenchWorkload(name, BenchRotozoom, i);
+    }
+
+    for (int32 i = INK_NONE; i <= INK_UNMASKED; ++i) {
+        sprintf(name, "rect_%s", benchInkNames[i]);
+        RunBenchWorkload(name, BenchRectangles, i);
+    }
+
+    RunBenchWorkload("deformed_none", BenchDeformed, INK_NONE);
+    RunBenchWorkload("deformed_alpha", BenchDeformed, INK_ALPHA);
+
+    RunBenchWorkload("layer_hscroll", BenchLayer, LAYER_HSCROLL);
+    RunBenchWorkload("layer_vscroll", BenchLayer, LAYER_VSCROLL);
+    RunBenchWorkload("layer_rotozoom", BenchLayer, LAYER_ROTOZOOM);
+    RunBenchWorkload("layer_basic", BenchLayer, LAYER_BASIC);
+
+    const int32 shapeInks[] = { INK_NONE, INK_ALPHA, INK_ADD, INK_TINT, INK_MASKED };
+    for (int32 i = 0; i < (int32)(sizeof(shapeInks) / sizeof(int32)); ++i) {
+        sprintf(name, "circle_%s", benchInkNames[shapeInks[i]]);
+        RunBenchWorkload(name, BenchCircles, shapeInks[i]);
+
+        sprintf(name, "ring_%s", benchInkNames[shapeInks[i]]);
+        RunBenchWorkload(name, BenchRings, shapeInks[i]);
+
+        sprintf(name, "face_%s", benchInkNames[shapeInks[i]]);
+        RunBenchWorkload(name, BenchFaces, shapeInks[i]);
+
+        sprintf(name, "blendedface_%s", benchInkNames[shapeInks[i]]);
+        RunBenchWorkload(name, BenchBlendedFaces, shapeInks[i]);
+    }
+
+    RunBenchWorkload("scene3d_wireframe", BenchScene3D, S3D_WIREFRAME_SCREEN);
+    RunBenchWorkload("scene3d_shaded", BenchScene3D, S3D_SOLIDCOLOR_SHADED_SCREEN);
+    RunBenchWorkload("scene3d_blended", BenchScene3D, S3D_SOLIDCOLOR_SHADED_BLENDED_SCREEN);
+    RunBenchWorkload("scene3d_clipped_shaded", BenchClippedScene3D, S3D_SOLIDCOLOR_SHADED_SCREEN);
+    RunBenchWorkload("scene3d_clipped_blended", BenchClippedScene3D, S3D_SOLIDCOLOR_SHADED_BLENDED_SCREEN);
+
+    // the deferred path has to come out identical to drawing straight away, goldens or not
+    uint64 immediateHash = RunBenchWorkload("mixed_immediate", BenchMixed, false);
+    uint64 deferredHash  = RunBenchWorkload("mixed_deferred", BenchMixed, true);
+    if (immediateHash != deferredHash) {
+        PrintLog(PRINT_NORMAL, "RenderBench: deferred draws don't match immediate draws");
+        ++benchFailures;
+    }
+
+    if (renderBenchUpdate && !SaveBenchGoldens())
+        ++benchFailures;
+
+    PrintLog(PRINT_NORMAL, "RenderBench: %d workloads, %d failed", benchResultCount, benchFailures);
+
+    ClearSurfaceRuns(&gfxSurface[benchSheetID]);
+    if (benchOwnsScanlines) {
+        free(scanlines);
+        scanlines = NULL;
+    }
+    ReleaseStorage();
+
+    return benchFailures;
+}
@@ -0,0 +1,18 @@
+#ifndef RENDERBENCH_H
+#define RENDERBENCH_H
+
+namespace RSDK
+{
+
+// set via "renderbench=<path>" to check against the golden hashes in this file, a missing file counts as a failure
+// "renderbenchupdate=<path>" sets it along with renderBenchUpdate, which (re)records the goldens there instead of checking them
+extern char renderBenchGoldens[0x100];
+extern bool32 renderBenchUpdate;
+
+// draws a fixed set of workloads into screens[0] without a render device, compares each one's framebuffer hash to the goldens
+// & logs pixels per second for each of them. returns the number of workloads that didn't match their golden
+int32 RunRenderBench();
+
+} // namespace RSDK
+
+#endif // RENDERBENCH_H
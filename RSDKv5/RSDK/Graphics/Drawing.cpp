@@ -1,5 +1,7 @@
 #include "RSDK/Core/RetroEngine.hpp"
 
+#include <vector>
+
 using namespace RSDK;
 
 #if RETRO_REV0U
@@ -231,6 +233,217 @@ char RSDK::drawGroupNames[0x10][0x10] = {
     if (frameBufferClr != maskColor)                                                                                                                 \
         frameBufferClr = pixel;
 
+// Ink kernels
+// these do the same thing as the setPixel macros above (down to the last bit), just 8 pixels at a time
+// the lookup tables are all "x * alpha >> 8" on 5-bit channels, which fits in 16-bit lanes just fine
+#if RETRO_SIMD_SSE2
+typedef __m128i InkVector;
+
+#define InkLoad(src)                 _mm_loadu_si128((const __m128i *)(src))
+#define InkStore(dst, v)             _mm_storeu_si128((__m128i *)(dst), v)
+#define InkSet(value)                _mm_set1_epi16((int16)(value))
+#define InkAnd(a, b)                 _mm_and_si128(a, b)
+#define InkOr(a, b)                  _mm_or_si128(a, b)
+#define InkAdd(a, b)                 _mm_add_epi16(a, b)
+#define InkSubSat(a, b)              _mm_subs_epu16(a, b)
+#define InkMin(a, b)                 _mm_min_epi16(a, b) // only ever used on small positive values
+#define InkShiftR(v, n)              _mm_srli_epi16(v, n)
+#define InkShiftL(v, n)              _mm_slli_epi16(v, n)
+#define InkMulShift8(v, alpha)       _mm_srli_epi16(_mm_mullo_epi16(v, alpha), 8)
+#define InkSelect(keep, a, b)        _mm_or_si128(_mm_and_si128(keep, a), _mm_andnot_si128(keep, b))
+#define InkLoadMaskKeep(mask)        _mm_cmpeq_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(mask)), _mm_setzero_si128()), _mm_setzero_si128())
+#elif RETRO_SIMD_NEON
+typedef uint16x8_t InkVector;
+
+#define InkLoad(src)           vld1q_u16(src)
+#define InkStore(dst, v)       vst1q_u16(dst, v)
+#define InkSet(value)          vdupq_n_u16((uint16)(value))
+#define InkAnd(a, b)           vandq_u16(a, b)
+#define InkOr(a, b)            vorrq_u16(a, b)
+#define InkAdd(a, b)           vaddq_u16(a, b)
+#define InkSubSat(a, b)        vqsubq_u16(a, b)
+#define InkMin(a, b)           vminq_u16(a, b)
+#define InkShiftR(v, n)        vshrq_n_u16(v, n)
+#define InkShiftL(v, n)        vshlq_n_u16(v, n)
+#define InkMulShift8(v, alpha) vshrq_n_u16(vmulq_u16(v, alpha), 8)
+#define InkSelect(keep, a, b)  vbslq_u16(keep, a, b)
+#define InkLoadMaskKeep(mask)  vceqq_u16(vmovl_u8(vld1_u8(mask)), vdupq_n_u16(0))
+#endif
+
+#if RETRO_SIMD_SSE2 || RETRO_SIMD_NEON
+// pixels with a 0 in mask keep the framebuffer colour
+#define InkWrite(dst, mask, fb, result)                                                                                                              \
+    if (mask)                                                                                                                                        \
+        InkStore(dst, InkSelect(InkLoadMaskKeep(mask), fb, result));                                                                                 \
+    else                                                                                                                                             \
+        InkStore(dst, result);
+#endif
+
+void RSDK::InkBlendSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count)
+{
+    int32 i = 0;
+
+#if RETRO_SIMD_SSE2 || RETRO_SIMD_NEON
+    const InkVector halfMask = InkSet(0x7BEF);
+    for (; i + 8 <= count; i += 8) {
+        InkVector px = InkLoad(&src[i]);
+        InkVector fb = InkLoad(&dst[i]);
+
+        InkVector result = InkAdd(InkAnd(InkShiftR(px, 1), halfMask), InkAnd(InkShiftR(fb, 1), halfMask));
+        InkWrite(&dst[i], mask ? &mask[i] : NULL, fb, result);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (!mask || mask[i])
+            setPixelBlend(src[i], dst[i]);
+    }
+}
+
+void RSDK::InkAlphaSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count, int32 alpha)
+{
+    int32 i = 0;
+
+#if RETRO_SIMD_SSE2 || RETRO_SIMD_NEON
+    const InkVector channelMask = InkSet(0x1F);
+    const InkVector pxAlpha     = InkSet(alpha);
+    const InkVector fbAlpha     = InkSet(0xFF - alpha);
+    for (; i + 8 <= count; i += 8) {
+        InkVector px = InkLoad(&src[i]);
+        InkVector fb = InkLoad(&dst[i]);
+
+        InkVector R = InkAdd(InkMulShift8(InkShiftR(fb, 11), fbAlpha), InkMulShift8(InkShiftR(px, 11), pxAlpha));
+        InkVector G = InkAdd(InkMulShift8(InkAnd(InkShiftR(fb, 6), channelMask), fbAlpha), InkMulShift8(InkAnd(InkShiftR(px, 6), channelMask), pxAlpha));
+        InkVector B = InkAdd(InkMulShift8(InkAnd(fb, channelMask), fbAlpha), InkMulShift8(InkAnd(px, channelMask), pxAlpha));
+
+        InkVector result = InkOr(InkOr(B, InkShiftL(G, 6)), InkShiftL(R, 11));
+        InkWrite(&dst[i], mask ? &mask[i] : NULL, fb, result);
+    }
+#endif
+
+    uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
+    uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
+    for (; i < count; ++i) {
+        if (!mask || mask[i]) {
+            setPixelAlpha(src[i], dst[i], alpha);
+        }
+    }
+}
+
+void RSDK::InkAddSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count, int32 alpha)
+{
+    int32 i = 0;
+
+#if RETRO_SIMD_SSE2 || RETRO_SIMD_NEON
+    // green keeps its 6th bit from the framebuffer here, so it's added at 6-bit precision
+    const InkVector channelMask = InkSet(0x1F);
+    const InkVector greenMask   = InkSet(0x3F);
+    const InkVector pxAlpha     = InkSet(alpha);
+    for (; i + 8 <= count; i += 8) {
+        InkVector px = InkLoad(&src[i]);
+        InkVector fb = InkLoad(&dst[i]);
+
+        InkVector R = InkMin(InkAdd(InkMulShift8(InkShiftR(px, 11), pxAlpha), InkShiftR(fb, 11)), channelMask);
+        InkVector G = InkMin(InkAdd(InkShiftL(InkMulShift8(InkAnd(InkShiftR(px, 6), channelMask), pxAlpha), 1), InkAnd(InkShiftR(fb, 5), greenMask)),
+                             greenMask);
+        InkVector B = InkMin(InkAdd(InkMulShift8(InkAnd(px, channelMask), pxAlpha), InkAnd(fb, channelMask)), channelMask);
+
+        InkVector result = InkOr(InkOr(B, InkShiftL(G, 5)), InkShiftL(R, 11));
+        InkWrite(&dst[i], mask ? &mask[i] : NULL, fb, result);
+    }
+#endif
+
+    uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
+    for (; i < count; ++i) {
+        if (!mask || mask[i]) {
+            setPixelAdditive(src[i], dst[i]);
+        }
+    }
+}
+
+void RSDK::InkSubSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count, int32 alpha)
+{
+    int32 i = 0;
+
+#if RETRO_SIMD_SSE2 || RETRO_SIMD_NEON
+    const InkVector channelMask = InkSet(0x1F);
+    const InkVector greenMask   = InkSet(0x3F);
+    const InkVector pxAlpha     = InkSet(alpha);
+    for (; i + 8 <= count; i += 8) {
+        InkVector px = InkLoad(&src[i]);
+        InkVector fb = InkLoad(&dst[i]);
+
+        // subtractLookupTable is "(0x1F - x) * alpha >> 8"
+        InkVector subR = InkMulShift8(InkSubSat(channelMask, InkShiftR(px, 11)), pxAlpha);
+        InkVector subG = InkMulShift8(InkSubSat(channelMask, InkAnd(InkShiftR(px, 6), channelMask)), pxAlpha);
+        InkVector subB = InkMulShift8(InkSubSat(channelMask, InkAnd(px, channelMask)), pxAlpha);
+
+        InkVector R = InkSubSat(InkShiftR(fb, 11), subR);
+        InkVector G = InkSubSat(InkAnd(InkShiftR(fb, 5), greenMask), InkShiftL(subG, 1));
+        InkVector B = InkSubSat(InkAnd(fb, channelMask), subB);
+
+        InkVector result = InkOr(InkOr(B, InkShiftL(G, 5)), InkShiftL(R, 11));
+        InkWrite(&dst[i], mask ? &mask[i] : NULL, fb, result);
+    }
+#endif
+
+    uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
+    for (; i < count; ++i) {
+        if (!mask || mask[i]) {
+            setPixelSubtractive(src[i], dst[i]);
+        }
+    }
+}
+
+void RSDK::InkFadeSpan(uint16 *dst, int32 count, int32 alphaR, int32 alphaG, int32 alphaB, uint16 clrBlendR, uint16 clrBlendG, uint16 clrBlendB)
+{
+    int32 i = 0;
+
+#if RETRO_SIMD_SSE2 || RETRO_SIMD_NEON
+    const InkVector channelMask = InkSet(0x1F);
+    const InkVector fbAlphaR    = InkSet(0xFF - alphaR);
+    const InkVector fbAlphaG    = InkSet(0xFF - alphaG);
+    const InkVector fbAlphaB    = InkSet(0xFF - alphaB);
+    const InkVector blendR      = InkSet(clrBlendR);
+    const InkVector blendG      = InkSet(clrBlendG);
+    const InkVector blendB      = InkSet(clrBlendB);
+    for (; i + 8 <= count; i += 8) {
+        InkVector fb = InkLoad(&dst[i]);
+
+        InkVector R = InkAdd(InkMulShift8(InkShiftR(fb, 11), fbAlphaR), blendR);
+        InkVector G = InkAdd(InkMulShift8(InkAnd(InkShiftR(fb, 6), channelMask), fbAlphaG), blendG);
+        InkVector B = InkAdd(InkMulShift8(InkAnd(fb, channelMask), fbAlphaB), blendB);
+
+        InkStore(&dst[i], InkOr(InkOr(B, InkShiftL(G, 6)), InkShiftL(R, 11)));
+    }
+#endif
+
+    uint16 *fbBlendR = &blendLookupTable[0x20 * (0xFF - alphaR)];
+    uint16 *fbBlendG = &blendLookupTable[0x20 * (0xFF - alphaG)];
+    uint16 *fbBlendB = &blendLookupTable[0x20 * (0xFF - alphaB)];
+    for (; i < count; ++i) {
+        uint16 px = dst[i];
+
+        int32 R = fbBlendR[(px & 0xF800) >> 11] + clrBlendR;
+        int32 G = fbBlendG[(px & 0x7E0) >> 6] + clrBlendG;
+        int32 B = fbBlendB[px & 0x1F] + clrBlendB;
+
+        dst[i] = (B) | (G << 6) | (R << 11);
+    }
+}
+
+// runs a span through whichever ink kernel matches inkEffect, only INK_BLEND, INK_ALPHA, INK_ADD & INK_SUB are handled here
+inline void DrawInkSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count, int32 inkEffect, int32 alpha)
+{
+    switch (inkEffect) {
+        default: break;
+        case INK_BLEND: InkBlendSpan(dst, src, mask, count); break;
+        case INK_ALPHA: InkAlphaSpan(dst, src, mask, count, alpha); break;
+        case INK_ADD: InkAddSpan(dst, src, mask, count, alpha); break;
+        case INK_SUB: InkSubSpan(dst, src, mask, count, alpha); break;
+    }
+}
+
 void RSDK::RenderDeviceBase::ProcessDimming()
 {
     // Bug Details:
@@ -254,6 +467,75 @@ void RSDK::RenderDeviceBase::ProcessDimming()
     }
 }
 
+struct FrameBufferUploadCache {
+    std::vector<uint16> lastFrame;
+    int32 pitch;
+    int32 fullFrames;
+    int32 skipFrames;
+    bool32 valid;
+};
+
+FrameBufferUploadCache uploadCache[SCREEN_COUNT];
+
+uint32 RSDK::GetFrameBufferUploadBands(int32 screenID)
+{
+    const uint32 allBands = (1 << FRAMEBUFFER_BAND_COUNT) - 1;
+
+    FrameBufferUploadCache *cache = &uploadCache[screenID];
+    ScreenInfo *screen            = &screens[screenID];
+    int32 bandSize                = screen->pitch * FRAMEBUFFER_BAND_SIZE;
+
+    // during gameplay pretty much every band changes every frame, so comparing them would only be wasted work
+    // after a few frames of that, just upload everything for a while before checking again
+    if (cache->skipFrames > 0) {
+        cache->skipFrames--;
+        return allBands;
+    }
+
+    if (!cache->valid || cache->pitch != screen->pitch) {
+        cache->lastFrame.resize(bandSize * FRAMEBUFFER_BAND_COUNT);
+        memcpy(cache->lastFrame.data(), screen->frameBuffer, bandSize * FRAMEBUFFER_BAND_COUNT * sizeof(uint16));
+
+        cache->pitch      = screen->pitch;
+        cache->fullFrames = 0;
+        cache->valid      = true;
+        return allBands;
+    }
+
+    uint32 bands = 0;
+    for (int32 b = 0; b < FRAMEBUFFER_BAND_COUNT; ++b) {
+        uint16 *frameBuffer = &screen->frameBuffer[b * bandSize];
+        uint16 *lastFrame   = &cache->lastFrame[b * bandSize];
+
+        if (memcmp(frameBuffer, lastFrame, bandSize * sizeof(uint16))) {
+            memcpy(lastFrame, frameBuffer, bandSize * sizeof(uint16));
+            bands |= 1 << b;
+        }
+    }
+
+    if (bands == allBands) {
+        if (++cache->fullFrames >= 4) {
+            // lastFrame won't be kept up to date while skipping, so it'll need a full refresh afterwards
+            cache->fullFrames = 0;
+            cache->skipFrames = 60;
+            cache->valid      = false;
+        }
+    }
+    else {
+        cache->fullFrames = 0;
+    }
+
+    return bands;
+}
+
+void RSDK::ResetFrameBufferBands()
+{
+    for (int32 s = 0; s < SCREEN_COUNT; ++s) {
+        uploadCache[s].valid      = false;
+        uploadCache[s].skipFrames = 0;
+    }
+}
+
 void RSDK::GenerateBlendLookupTable()
 {
     for (int32 y = 0; y < 0x100; y++) {
@@ -585,6 +867,8 @@ void RSDK::SwapDrawListEntries(uint8 drawGroup, uint16 slot1, uint16 slot2, uint
 
 void RSDK::FillScreen(uint32 color, int32 alphaR, int32 alphaG, int32 alphaB)
 {
+    FlushPendingDraws();
+
     alphaR = CLAMP(alphaR, 0x00, 0xFF);
     alphaG = CLAMP(alphaG, 0x00, 0xFF);
     alphaB = CLAMP(alphaB, 0x00, 0xFF);
@@ -595,25 +879,14 @@ void RSDK::FillScreen(uint32 color, int32 alphaR, int32 alphaG, int32 alphaB)
         uint16 clrBlendG = blendLookupTable[0x20 * alphaG + rgb32To16_B[(color >> 0x08) & 0xFF]];
         uint16 clrBlendB = blendLookupTable[0x20 * alphaB + rgb32To16_B[(color >> 0x00) & 0xFF]];
 
-        uint16 *fbBlendR = &blendLookupTable[0x20 * (0xFF - alphaR)];
-        uint16 *fbBlendG = &blendLookupTable[0x20 * (0xFF - alphaG)];
-        uint16 *fbBlendB = &blendLookupTable[0x20 * (0xFF - alphaB)];
-
-        int32 cnt = currentScreen->size.y * currentScreen->pitch;
-        for (int32 id = 0; cnt > 0; --cnt, ++id) {
-            uint16 px = currentScreen->frameBuffer[id];
-
-            int32 R = fbBlendR[(px & 0xF800) >> 11] + clrBlendR;
-            int32 G = fbBlendG[(px & 0x7E0) >> 6] + clrBlendG;
-            int32 B = fbBlendB[px & 0x1F] + clrBlendB;
-
-            currentScreen->frameBuffer[id] = (B) | (G << 6) | (R << 11);
-        }
+        InkFadeSpan(currentScreen->frameBuffer, currentScreen->size.y * currentScreen->pitch, alphaR, alphaG, alphaB, clrBlendR, clrBlendG, clrBlendB);
     }
 }
 
 void RSDK::DrawLine(int32 x1, int32 y1, int32 x2, int32 y2, uint32 color, int32 alpha, int32 inkEffect, bool32 screenRelative)
 {
+    FlushPendingDraws();
+
     switch (inkEffect) {
         default: break;
 
@@ -1141,61 +1414,10 @@ void RSDK::DrawLine(int32 x1, int32 y1, int32 x2, int32 y2, uint32 color, int32
             break;
     }
 }
-void RSDK::DrawRectangle(int32 x, int32 y, int32 width, int32 height, uint32 color, int32 alpha, int32 inkEffect, bool32 screenRelative)
+// fills an already clipped rect with color16, frameBuffer is the top-left pixel
+void BlitRectangle(uint16 *frameBuffer, int32 width, int32 height, uint16 color16, int32 inkEffect, int32 alpha)
 {
-    switch (inkEffect) {
-        default: break;
-        case INK_ALPHA:
-            if (alpha > 0xFF)
-                inkEffect = INK_NONE;
-            else if (alpha <= 0)
-                return;
-            break;
-
-        case INK_ADD:
-        case INK_SUB:
-            if (alpha > 0xFF)
-                alpha = 0xFF;
-            else if (alpha <= 0)
-                return;
-            break;
-
-        case INK_TINT:
-            if (!tintLookupTable)
-                return;
-            break;
-    }
-
-    if (!screenRelative) {
-        x      = FROM_FIXED(x) - currentScreen->position.x;
-        y      = FROM_FIXED(y) - currentScreen->position.y;
-        width  = FROM_FIXED(width);
-        height = FROM_FIXED(height);
-    }
-
-    if (width + x > currentScreen->clipBound_X2)
-        width = currentScreen->clipBound_X2 - x;
-
-    if (x < currentScreen->clipBound_X1) {
-        width += x - currentScreen->clipBound_X1;
-        x = currentScreen->clipBound_X1;
-    }
-
-    if (height + y > currentScreen->clipBound_Y2)
-        height = currentScreen->clipBound_Y2 - y;
-
-    if (y < currentScreen->clipBound_Y1) {
-        height += y - currentScreen->clipBound_Y1;
-        y = currentScreen->clipBound_Y1;
-    }
-
-    if (width <= 0 || height <= 0)
-        return;
-
-    int32 pitch         = currentScreen->pitch - width;
-    validDraw           = true;
-    uint16 *frameBuffer = &currentScreen->frameBuffer[x + (y * currentScreen->pitch)];
-    uint16 color16      = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
+    int32 pitch = currentScreen->pitch - width;
 
     switch (inkEffect) {
         case INK_NONE: {
@@ -1212,59 +1434,17 @@ void RSDK::DrawRectangle(int32 x, int32 y, int32 width, int32 height, uint32 col
             break;
         }
 
-        case INK_BLEND: {
-            int32 h = height;
-            while (h--) {
-                int32 w = width;
-                while (w--) {
-                    setPixelBlend(color16, *frameBuffer);
-                    ++frameBuffer;
-                }
-                frameBuffer += pitch;
-            }
-            break;
-        }
-
-        case INK_ALPHA: {
-            uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-            uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
+        case INK_BLEND:
+        case INK_ALPHA:
+        case INK_ADD:
+        case INK_SUB: {
+            uint16 colorLine[SCREEN_XMAX];
+            for (int32 i = 0; i < width; ++i) colorLine[i] = color16;
 
             int32 h = height;
             while (h--) {
-                int32 w = width;
-                while (w--) {
-                    setPixelAlpha(color16, *frameBuffer, alpha);
-                    ++frameBuffer;
-                }
-                frameBuffer += pitch;
-            }
-            break;
-        }
-
-        case INK_ADD: {
-            uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-            int32 h               = height;
-            while (h--) {
-                int32 w = width;
-                while (w--) {
-                    setPixelAdditive(color16, *frameBuffer);
-                    ++frameBuffer;
-                }
-                frameBuffer += pitch;
-            }
-            break;
-        }
-
-        case INK_SUB: {
-            uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-            int32 h               = height;
-            while (h--) {
-                int32 w = width;
-                while (w--) {
-                    setPixelSubtractive(color16, *frameBuffer);
-                    ++frameBuffer;
-                }
-                frameBuffer += pitch;
+                DrawInkSpan(frameBuffer, colorLine, NULL, width, inkEffect, alpha);
+                frameBuffer += currentScreen->pitch;
             }
             break;
         }
@@ -1311,66 +1491,196 @@ void RSDK::DrawRectangle(int32 x, int32 y, int32 width, int32 height, uint32 col
         }
     }
 }
-void RSDK::DrawCircle(int32 x, int32 y, int32 radius, uint32 color, int32 alpha, int32 inkEffect, bool32 screenRelative)
+// fills count pixels from frameBuffer with color16, colorLine is a run of color16 for the span kernels to read from
+inline void BlitColorSpan(uint16 *frameBuffer, const uint16 *colorLine, int32 count, uint16 color16, int32 inkEffect, int32 alpha)
 {
-    if (radius > 0) {
-        switch (inkEffect) {
-            default: break;
-            case INK_ALPHA:
-                if (alpha > 0xFF)
-                    inkEffect = INK_NONE;
-                else if (alpha <= 0)
-                    return;
-                break;
-
-            case INK_ADD:
-            case INK_SUB:
-                if (alpha > 0xFF)
-                    alpha = 0xFF;
-                else if (alpha <= 0)
-                    return;
-                break;
+    switch (inkEffect) {
+        default: break;
+        case INK_NONE:
+            for (int32 x = 0; x < count; ++x) frameBuffer[x] = color16;
+            break;
 
-            case INK_TINT:
-                if (!tintLookupTable)
-                    return;
-                break;
-        }
+        case INK_BLEND:
+        case INK_ALPHA:
+        case INK_ADD:
+        case INK_SUB: DrawInkSpan(frameBuffer, colorLine, NULL, count, inkEffect, alpha); break;
 
-        if (!screenRelative) {
-            x = FROM_FIXED(x) - currentScreen->position.x;
-            y = FROM_FIXED(y) - currentScreen->position.y;
-        }
+        case INK_TINT:
+            for (int32 x = 0; x < count; ++x) frameBuffer[x] = tintLookupTable[frameBuffer[x]];
+            break;
 
-        int32 yRadiusBottom = y + radius;
-        int32 bottom        = yRadiusBottom + 1;
-        int32 yRadiusTop    = y - radius;
-        int32 top           = yRadiusTop;
+        case INK_MASKED:
+            for (int32 x = 0; x < count; ++x) {
+                if (frameBuffer[x] == maskColor)
+                    frameBuffer[x] = color16;
+            }
+            break;
 
-        if (top < currentScreen->clipBound_Y1)
-            top = currentScreen->clipBound_Y1;
-        else if (top > currentScreen->clipBound_Y2)
-            top = currentScreen->clipBound_Y2;
+        case INK_UNMASKED:
+            for (int32 x = 0; x < count; ++x) {
+                if (frameBuffer[x] != maskColor)
+                    frameBuffer[x] = color16;
+            }
+            break;
+    }
+}
+// clips & fills the scanEdgeBuffer spans for lineCount rows starting at top
+void BlitScanEdges(int32 top, int32 lineCount, uint16 color16, int32 inkEffect, int32 alpha)
+{
+    uint16 colorLine[SCREEN_XMAX];
+    if (inkEffect >= INK_BLEND && inkEffect <= INK_SUB) {
+        for (int32 i = 0; i < currentScreen->clipBound_X2 - currentScreen->clipBound_X1; ++i) colorLine[i] = color16;
+    }
 
-        if (bottom < currentScreen->clipBound_Y1)
-            bottom = currentScreen->clipBound_Y1;
-        else if (bottom > currentScreen->clipBound_Y2)
-            bottom = currentScreen->clipBound_Y2;
+    ScanEdge *edge      = &scanEdgeBuffer[top];
+    uint16 *frameBuffer = &currentScreen->frameBuffer[top * currentScreen->pitch];
+    for (int32 y = 0; y < lineCount; ++y) {
+        int32 start = CLAMP(edge->start, currentScreen->clipBound_X1, currentScreen->clipBound_X2);
+        int32 end   = CLAMP(edge->end, currentScreen->clipBound_X1, currentScreen->clipBound_X2);
 
-        if (top != bottom) {
-            for (int32 i = top; i < bottom; ++i) {
-                scanEdgeBuffer[i].start = 0x7FFF;
-                scanEdgeBuffer[i].end   = -1;
-            }
+        if (end > start)
+            BlitColorSpan(&frameBuffer[start], colorLine, end - start, color16, inkEffect, alpha);
 
-            int32 r                  = 3 - 2 * radius;
-            int32 xRad               = x - radius;
-            int32 curY               = y;
-            int32 curX               = x;
-            int32 dist               = x - y;
+        ++edge;
+        frameBuffer += currentScreen->pitch;
+    }
+}
+// largest r with r * r < dist2, or -1 if there isn't one
+inline int32 GetSpanRadius(int32 dist2)
+{
+    if (dist2 <= 0)
+        return -1;
 
-            for (int32 i = 0; i <= radius; ++i) {
-                int32 scanX = i + curX;
+    int32 r = (int32)sqrtf((float)dist2);
+    while (r > 0 && (int64)r * r >= dist2) --r;
+    while ((int64)(r + 1) * (r + 1) < dist2) ++r;
+    return r;
+}
+
+void RSDK::DrawRectangle(int32 x, int32 y, int32 width, int32 height, uint32 color, int32 alpha, int32 inkEffect, bool32 screenRelative)
+{
+    switch (inkEffect) {
+        default: break;
+        case INK_ALPHA:
+            if (alpha > 0xFF)
+                inkEffect = INK_NONE;
+            else if (alpha <= 0)
+                return;
+            break;
+
+        case INK_ADD:
+        case INK_SUB:
+            if (alpha > 0xFF)
+                alpha = 0xFF;
+            else if (alpha <= 0)
+                return;
+            break;
+
+        case INK_TINT:
+            if (!tintLookupTable)
+                return;
+            break;
+    }
+
+    if (!screenRelative) {
+        x      = FROM_FIXED(x) - currentScreen->position.x;
+        y      = FROM_FIXED(y) - currentScreen->position.y;
+        width  = FROM_FIXED(width);
+        height = FROM_FIXED(height);
+    }
+
+    if (width + x > currentScreen->clipBound_X2)
+        width = currentScreen->clipBound_X2 - x;
+
+    if (x < currentScreen->clipBound_X1) {
+        width += x - currentScreen->clipBound_X1;
+        x = currentScreen->clipBound_X1;
+    }
+
+    if (height + y > currentScreen->clipBound_Y2)
+        height = currentScreen->clipBound_Y2 - y;
+
+    if (y < currentScreen->clipBound_Y1) {
+        height += y - currentScreen->clipBound_Y1;
+        y = currentScreen->clipBound_Y1;
+    }
+
+    if (width <= 0 || height <= 0)
+        return;
+
+    validDraw      = true;
+    uint16 color16 = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
+
+    if (drawRecording) {
+        DrawCommand *command = AddDrawCommand(DRAWCMD_RECTANGLE, x, y, width, height, inkEffect, alpha);
+        command->color       = color16;
+    }
+    else {
+        BlitRectangle(&currentScreen->frameBuffer[x + (y * currentScreen->pitch)], width, height, color16, inkEffect, alpha);
+    }
+}
+void RSDK::DrawCircle(int32 x, int32 y, int32 radius, uint32 color, int32 alpha, int32 inkEffect, bool32 screenRelative)
+{
+    FlushPendingDraws();
+
+    if (radius > 0) {
+        switch (inkEffect) {
+            default: break;
+            case INK_ALPHA:
+                if (alpha > 0xFF)
+                    inkEffect = INK_NONE;
+                else if (alpha <= 0)
+                    return;
+                break;
+
+            case INK_ADD:
+            case INK_SUB:
+                if (alpha > 0xFF)
+                    alpha = 0xFF;
+                else if (alpha <= 0)
+                    return;
+                break;
+
+            case INK_TINT:
+                if (!tintLookupTable)
+                    return;
+                break;
+        }
+
+        if (!screenRelative) {
+            x = FROM_FIXED(x) - currentScreen->position.x;
+            y = FROM_FIXED(y) - currentScreen->position.y;
+        }
+
+        int32 yRadiusBottom = y + radius;
+        int32 bottom        = yRadiusBottom + 1;
+        int32 yRadiusTop    = y - radius;
+        int32 top           = yRadiusTop;
+
+        if (top < currentScreen->clipBound_Y1)
+            top = currentScreen->clipBound_Y1;
+        else if (top > currentScreen->clipBound_Y2)
+            top = currentScreen->clipBound_Y2;
+
+        if (bottom < currentScreen->clipBound_Y1)
+            bottom = currentScreen->clipBound_Y1;
+        else if (bottom > currentScreen->clipBound_Y2)
+            bottom = currentScreen->clipBound_Y2;
+
+        if (top != bottom) {
+            for (int32 i = top; i < bottom; ++i) {
+                scanEdgeBuffer[i].start = 0x7FFF;
+                scanEdgeBuffer[i].end   = -1;
+            }
+
+            int32 r                  = 3 - 2 * radius;
+            int32 xRad               = x - radius;
+            int32 curY               = y;
+            int32 curX               = x;
+            int32 dist               = x - y;
+
+            for (int32 i = 0; i <= radius; ++i) {
+                int32 scanX = i + curX;
 
                 if (yRadiusBottom >= top && yRadiusBottom <= bottom && scanX > scanEdgeBuffer[yRadiusBottom].end)
                     scanEdgeBuffer[yRadiusBottom].end = scanX;
@@ -1418,235 +1728,16 @@ void RSDK::DrawCircle(int32 x, int32 y, int32 radius, uint32 color, int32 alpha,
             }
 
             // validDraw              = true;
-            uint16 *frameBuffer = &currentScreen->frameBuffer[top * currentScreen->pitch];
-            uint16 color16      = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
-
-            switch (inkEffect) {
-                default: break;
-                case INK_NONE:
-                    if (top <= bottom) {
-                        ScanEdge *edge = &scanEdgeBuffer[top];
-                        int32 sizeY    = bottom - top;
-
-                        for (int32 y = 0; y < sizeY; ++y) {
-                            if (edge->start < currentScreen->clipBound_X1)
-                                edge->start = currentScreen->clipBound_X1;
-                            if (edge->start > currentScreen->clipBound_X2)
-                                edge->start = currentScreen->clipBound_X2;
-
-                            if (edge->end < currentScreen->clipBound_X1)
-                                edge->end = currentScreen->clipBound_X1;
-                            if (edge->end > currentScreen->clipBound_X2)
-                                edge->end = currentScreen->clipBound_X2;
-
-                            int32 count = edge->end - edge->start;
-                            for (int32 x = 0; x < count; ++x) {
-                                frameBuffer[edge->start + x] = color16;
-                            }
-                            ++edge;
-                            frameBuffer += currentScreen->pitch;
-                        }
-                    }
-                    break;
-
-                case INK_BLEND:
-                    if (top <= bottom) {
-                        ScanEdge *edge = &scanEdgeBuffer[top];
-                        int32 sizeY    = bottom - top;
-
-                        for (int32 y = 0; y < sizeY; ++y) {
-                            if (edge->start < currentScreen->clipBound_X1)
-                                edge->start = currentScreen->clipBound_X1;
-                            if (edge->start > currentScreen->clipBound_X2)
-                                edge->start = currentScreen->clipBound_X2;
-
-                            if (edge->end < currentScreen->clipBound_X1)
-                                edge->end = currentScreen->clipBound_X1;
-                            if (edge->end > currentScreen->clipBound_X2)
-                                edge->end = currentScreen->clipBound_X2;
-
-                            int32 count = edge->end - edge->start;
-                            for (int32 x = 0; x < count; ++x) {
-                                setPixelBlend(color16, frameBuffer[edge->start + x]);
-                            }
-
-                            ++edge;
-                            frameBuffer += currentScreen->pitch;
-                        }
-                    }
-                    break;
-
-                case INK_ALPHA:
-                    if (top <= bottom) {
-                        uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                        uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-                        ScanEdge *edge = &scanEdgeBuffer[top];
-                        int32 sizeY    = bottom - top;
-
-                        for (int32 y = 0; y < sizeY; ++y) {
-                            if (edge->start < currentScreen->clipBound_X1)
-                                edge->start = currentScreen->clipBound_X1;
-                            if (edge->start > currentScreen->clipBound_X2)
-                                edge->start = currentScreen->clipBound_X2;
-
-                            if (edge->end < currentScreen->clipBound_X1)
-                                edge->end = currentScreen->clipBound_X1;
-                            if (edge->end > currentScreen->clipBound_X2)
-                                edge->end = currentScreen->clipBound_X2;
-
-                            int32 count = edge->end - edge->start;
-                            for (int32 x = 0; x < count; ++x) {
-                                setPixelAlpha(color16, frameBuffer[edge->start + x], alpha);
-                            }
-                            ++edge;
-                            frameBuffer += currentScreen->pitch;
-                        }
-                    }
-                    break;
-
-                case INK_ADD: {
-                    uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-                    if (top <= bottom) {
-                        ScanEdge *edge = &scanEdgeBuffer[top];
-                        int32 sizeY    = bottom - top;
-
-                        for (int32 y = 0; y < sizeY; ++y) {
-                            if (edge->start < currentScreen->clipBound_X1)
-                                edge->start = currentScreen->clipBound_X1;
-                            if (edge->start > currentScreen->clipBound_X2)
-                                edge->start = currentScreen->clipBound_X2;
-
-                            if (edge->end < currentScreen->clipBound_X1)
-                                edge->end = currentScreen->clipBound_X1;
-                            if (edge->end > currentScreen->clipBound_X2)
-                                edge->end = currentScreen->clipBound_X2;
-
-                            int32 count = edge->end - edge->start;
-                            for (int32 x = 0; x < count; ++x) {
-                                setPixelAdditive(color16, frameBuffer[edge->start + x]);
-                            }
-                            ++edge;
-                            frameBuffer += currentScreen->pitch;
-                        }
-                    }
-                    break;
-                }
-
-                case INK_SUB: {
-                    uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-                    if (top <= bottom) {
-                        ScanEdge *edge = &scanEdgeBuffer[top];
-                        int32 sizeY    = bottom - top;
-
-                        for (int32 y = 0; y < sizeY; ++y) {
-                            if (edge->start < currentScreen->clipBound_X1)
-                                edge->start = currentScreen->clipBound_X1;
-                            if (edge->start > currentScreen->clipBound_X2)
-                                edge->start = currentScreen->clipBound_X2;
-
-                            if (edge->end < currentScreen->clipBound_X1)
-                                edge->end = currentScreen->clipBound_X1;
-                            if (edge->end > currentScreen->clipBound_X2)
-                                edge->end = currentScreen->clipBound_X2;
-
-                            int32 count = edge->end - edge->start;
-                            for (int32 x = 0; x < count; ++x) {
-                                setPixelSubtractive(color16, frameBuffer[edge->start + x]);
-                            }
-                            ++edge;
-                            frameBuffer += currentScreen->pitch;
-                        }
-                    }
-                    break;
-                }
-
-                case INK_TINT:
-                    if (top <= bottom) {
-                        ScanEdge *edge = &scanEdgeBuffer[top];
-                        int32 sizeY    = bottom - top;
-
-                        for (int32 y = 0; y < sizeY; ++y) {
-                            if (edge->start < currentScreen->clipBound_X1)
-                                edge->start = currentScreen->clipBound_X1;
-                            if (edge->start > currentScreen->clipBound_X2)
-                                edge->start = currentScreen->clipBound_X2;
-
-                            if (edge->end < currentScreen->clipBound_X1)
-                                edge->end = currentScreen->clipBound_X1;
-                            if (edge->end > currentScreen->clipBound_X2)
-                                edge->end = currentScreen->clipBound_X2;
-
-                            int32 count = edge->end - edge->start;
-                            for (int32 x = 0; x < count; ++x) {
-                                frameBuffer[edge->start + x] = tintLookupTable[frameBuffer[edge->start + x]];
-                            }
-                            ++edge;
-                            frameBuffer += currentScreen->pitch;
-                        }
-                    }
-                    break;
-
-                case INK_MASKED:
-                    if (top <= bottom) {
-                        ScanEdge *edge = &scanEdgeBuffer[top];
-                        int32 sizeY    = bottom - top;
-
-                        for (int32 y = 0; y < sizeY; ++y) {
-                            if (edge->start < currentScreen->clipBound_X1)
-                                edge->start = currentScreen->clipBound_X1;
-                            if (edge->start > currentScreen->clipBound_X2)
-                                edge->start = currentScreen->clipBound_X2;
-
-                            if (edge->end < currentScreen->clipBound_X1)
-                                edge->end = currentScreen->clipBound_X1;
-                            if (edge->end > currentScreen->clipBound_X2)
-                                edge->end = currentScreen->clipBound_X2;
-
-                            int32 count = edge->end - edge->start;
-                            for (int32 x = 0; x < count; ++x) {
-                                if (frameBuffer[edge->start + x] == maskColor)
-                                    frameBuffer[edge->start + x] = color16;
-                            }
-                            ++edge;
-                            frameBuffer += currentScreen->pitch;
-                        }
-                    }
-                    break;
-
-                case INK_UNMASKED:
-                    if (top <= bottom) {
-                        ScanEdge *edge = &scanEdgeBuffer[top];
-                        int32 sizeY    = bottom - top;
-
-                        for (int32 y = 0; y < sizeY; ++y) {
-                            if (edge->start < currentScreen->clipBound_X1)
-                                edge->start = currentScreen->clipBound_X1;
-                            if (edge->start > currentScreen->clipBound_X2)
-                                edge->start = currentScreen->clipBound_X2;
-
-                            if (edge->end < currentScreen->clipBound_X1)
-                                edge->end = currentScreen->clipBound_X1;
-                            if (edge->end > currentScreen->clipBound_X2)
-                                edge->end = currentScreen->clipBound_X2;
-
-                            int32 count = edge->end - edge->start;
-                            for (int32 x = 0; x < count; ++x) {
-                                if (frameBuffer[edge->start + x] != maskColor)
-                                    frameBuffer[edge->start + x] = color16;
-                            }
-                            ++edge;
-                            frameBuffer += currentScreen->pitch;
-                        }
-                    }
-                    break;
-            }
+            uint16 color16 = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
+            BlitScanEdges(top, bottom - top, color16, inkEffect, alpha);
         }
     }
 }
 void RSDK::DrawCircleOutline(int32 x, int32 y, int32 innerRadius, int32 outerRadius, uint32 color, int32 alpha, int32 inkEffect,
                              bool32 screenRelative)
 {
+    FlushPendingDraws();
+
     switch (inkEffect) {
         default: break;
         case INK_ALPHA:
@@ -1705,221 +1796,46 @@ void RSDK::DrawCircleOutline(int32 x, int32 y, int32 innerRadius, int32 outerRad
             int32 ir2           = innerRadius * innerRadius;
             int32 or2           = outerRadius * outerRadius;
             validDraw           = true;
-            uint16 *frameBuffer = &currentScreen->frameBuffer[left + top * currentScreen->pitch];
             uint16 color16      = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
-            int32 pitch         = (left + currentScreen->pitch - right);
 
-            switch (inkEffect) {
-                default: break;
-                case INK_NONE:
-                    if (top < bottom) {
-                        int32 distY1 = top - y;
-                        int32 distY2 = bottom - top;
-                        do {
-                            int32 y2 = distY1 * distY1;
-                            if (left < right) {
-                                int32 distX1 = left - x;
-                                int32 distX2 = right - left;
-                                do {
-                                    int32 r2 = y2 + distX1 * distX1;
-                                    if (r2 >= ir2 && r2 < or2)
-                                        *frameBuffer = color16;
-                                    ++frameBuffer;
-                                    ++distX1;
-                                    --distX2;
-                                } while (distX2);
-                            }
-                            frameBuffer += pitch;
-                            --distY2;
-                            ++distY1;
-                        } while (distY2);
-                    }
-                    break;
+            uint16 colorLine[SCREEN_XMAX];
+            if (inkEffect >= INK_BLEND && inkEffect <= INK_SUB) {
+                for (int32 i = 0; i < right - left; ++i) colorLine[i] = color16;
+            }
 
-                case INK_BLEND:
-                    if (top < bottom) {
-                        int32 distY1 = top - y;
-                        int32 distY2 = bottom - top;
-                        do {
-                            int32 y2 = distY1 * distY1;
-                            if (left < right) {
-                                int32 distX1 = left - x;
-                                int32 distX2 = right - left;
-                                do {
-                                    int32 r2 = y2 + distX1 * distX1;
-                                    if (r2 >= ir2 && r2 < or2)
-                                        setPixelBlend(color16, *frameBuffer);
-                                    ++frameBuffer;
-                                    ++distX1;
-                                    --distX2;
-                                } while (distX2);
-                            }
-                            frameBuffer += pitch;
-                            --distY2;
-                            ++distY1;
-                        } while (distY2);
-                    }
-                    break;
+            // rows further than the outer radius from the center have no coverage at all
+            int32 rowTop        = MAX(top, y - outerRadius + 1);
+            int32 rowBottom     = MIN(bottom, y + outerRadius);
+            uint16 *frameBuffer = &currentScreen->frameBuffer[rowTop * currentScreen->pitch];
 
-                case INK_ALPHA:
-                    if (top < bottom) {
-                        uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                        uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-                        int32 distY1 = top - y;
-                        int32 distY2 = bottom - top;
-                        do {
-                            int32 y2 = distY1 * distY1;
-                            if (left < right) {
-                                int32 distX1 = left - x;
-                                int32 distX2 = right - left;
-                                do {
-                                    int32 r2 = y2 + distX1 * distX1;
-                                    if (r2 >= ir2 && r2 < or2) {
-                                        setPixelAlpha(color16, *frameBuffer, alpha);
-                                    }
-                                    ++frameBuffer;
-                                    ++distX1;
-                                    --distX2;
-                                } while (distX2);
-                            }
-                            frameBuffer += pitch;
-                            --distY2;
-                            ++distY1;
-                        } while (distY2);
-                    }
-                    break;
+            for (int32 row = rowTop; row < rowBottom; ++row) {
+                // covered pixels are ir2 <= dx * dx + dy * dy < or2, so each row is up to 2 spans either side of the hole
+                int32 y2     = (row - y) * (row - y);
+                int32 outerX = GetSpanRadius(or2 - y2);
+                int32 innerX = GetSpanRadius(ir2 - y2);
 
-                case INK_ADD: {
-                    uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-                    if (top < bottom) {
-                        int32 distY1 = top - y;
-                        int32 distY2 = bottom - top;
-                        do {
-                            int32 y2 = distY1 * distY1;
-                            if (left < right) {
-                                int32 distX1 = left - x;
-                                int32 distX2 = right - left;
-                                do {
-                                    int32 r2 = y2 + distX1 * distX1;
-                                    if (r2 >= ir2 && r2 < or2) {
-                                        setPixelAdditive(color16, *frameBuffer);
-                                    }
-                                    ++frameBuffer;
-                                    ++distX1;
-                                    --distX2;
-                                } while (distX2);
-                            }
-                            frameBuffer += pitch;
-                            --distY2;
-                            ++distY1;
-                        } while (distY2);
-                    }
-                    break;
+                int32 spanX1[2], spanX2[2];
+                int32 spanCount = 1;
+                if (innerX < 0) {
+                    spanX1[0] = x - outerX;
+                    spanX2[0] = x + outerX + 1;
                 }
-
-                case INK_SUB: {
-                    uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-                    if (top < bottom) {
-                        int32 distY1 = top - y;
-                        int32 distY2 = bottom - top;
-                        do {
-                            int32 y2 = distY1 * distY1;
-                            if (left < right) {
-                                int32 distX1 = left - x;
-                                int32 distX2 = right - left;
-                                do {
-                                    int32 r2 = y2 + distX1 * distX1;
-                                    if (r2 >= ir2 && r2 < or2) {
-                                        setPixelSubtractive(color16, *frameBuffer);
-                                    }
-                                    ++frameBuffer;
-                                    ++distX1;
-                                    --distX2;
-                                } while (distX2);
-                            }
-                            frameBuffer += pitch;
-                            --distY2;
-                            ++distY1;
-                        } while (distY2);
-                    }
-                    break;
+                else {
+                    spanX1[0] = x - outerX;
+                    spanX2[0] = x - innerX;
+                    spanX1[1] = x + innerX + 1;
+                    spanX2[1] = x + outerX + 1;
+                    spanCount = 2;
                 }
 
-                case INK_TINT:
-                    if (top < bottom) {
-                        int32 distY1 = top - y;
-                        int32 distY2 = bottom - top;
-                        do {
-                            int32 y2 = distY1 * distY1;
-                            if (left < right) {
-                                int32 distX1 = left - x;
-                                int32 distX2 = right - left;
-                                do {
-                                    int32 r2 = y2 + distX1 * distX1;
-                                    if (r2 >= ir2 && r2 < or2)
-                                        *frameBuffer = tintLookupTable[*frameBuffer];
-                                    ++frameBuffer;
-                                    ++distX1;
-                                    --distX2;
-                                } while (distX2);
-                            }
-                            frameBuffer += pitch;
-                            --distY2;
-                            ++distY1;
-                        } while (distY2);
-                    }
-                    break;
-
-                case INK_MASKED:
-                    if (top < bottom) {
-                        int32 distY1 = top - y;
-                        int32 distY2 = bottom - top;
-                        do {
-                            int32 y2 = distY1 * distY1;
-                            if (left < right) {
-                                int32 distX1 = left - x;
-                                int32 distX2 = right - left;
-                                do {
-                                    int32 r2 = y2 + distX1 * distX1;
-                                    if (r2 >= ir2 && r2 < or2 && *frameBuffer == maskColor)
-                                        *frameBuffer = color16;
-                                    ++frameBuffer;
-                                    ++distX1;
-                                    --distX2;
-                                } while (distX2);
-                            }
-                            frameBuffer += pitch;
-                            --distY2;
-                            ++distY1;
-                        } while (distY2);
-                    }
-                    break;
+                for (int32 s = 0; s < spanCount; ++s) {
+                    int32 start = MAX(spanX1[s], left);
+                    int32 end   = MIN(spanX2[s], right);
+                    if (end > start)
+                        BlitColorSpan(&frameBuffer[start], colorLine, end - start, color16, inkEffect, alpha);
+                }
 
-                case INK_UNMASKED:
-                    if (top < bottom) {
-                        int32 distY1 = top - y;
-                        int32 distY2 = bottom - top;
-                        do {
-                            int32 y2 = distY1 * distY1;
-                            if (left < right) {
-                                int32 distX1 = left - x;
-                                int32 distX2 = right - left;
-                                do {
-                                    int32 r2 = y2 + distX1 * distX1;
-                                    if (r2 >= ir2 && r2 < or2 && *frameBuffer != maskColor)
-                                        *frameBuffer = color16;
-                                    ++frameBuffer;
-                                    ++distX1;
-                                    --distX2;
-                                } while (distX2);
-                            }
-                            frameBuffer += pitch;
-                            --distY2;
-                            ++distY1;
-                        } while (distY2);
-                    }
-                    break;
+                frameBuffer += currentScreen->pitch;
             }
         }
     }
@@ -1927,6 +1843,8 @@ void RSDK::DrawCircleOutline(int32 x, int32 y, int32 innerRadius, int32 outerRad
 
 void RSDK::DrawFace(Vector2 *vertices, int32 vertCount, int32 r, int32 g, int32 b, int32 alpha, int32 inkEffect)
 {
+    FlushPendingDraws();
+
     switch (inkEffect) {
         default: break;
         case INK_ALPHA:
@@ -1985,223 +1903,36 @@ void RSDK::DrawFace(Vector2 *vertices, int32 vertCount, int32 r, int32 g, int32
         }
         ProcessScanEdge(vertices[0].x, vertices[0].y, vertices[vertCount - 1].x, vertices[vertCount - 1].y);
 
-        uint16 *frameBuffer = &currentScreen->frameBuffer[topScreen * currentScreen->pitch];
-        uint16 color16      = rgb32To16_B[b] | rgb32To16_G[g] | rgb32To16_R[r];
+        uint16 color16 = rgb32To16_B[b] | rgb32To16_G[g] | rgb32To16_R[r];
+        BlitScanEdges(topScreen, bottomScreen - topScreen + 1, color16, inkEffect, alpha);
+    }
+}
+void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, int32 alpha, int32 inkEffect)
+{
+    FlushPendingDraws();
 
-        edge = &scanEdgeBuffer[topScreen];
-        switch (inkEffect) {
-            default: break;
+    switch (inkEffect) {
+        default: break;
+        case INK_ALPHA:
+            if (alpha > 0xFF)
+                inkEffect = INK_NONE;
+            else if (alpha <= 0)
+                return;
+            break;
 
-            case INK_NONE:
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    if (edge->start < currentScreen->clipBound_X1)
-                        edge->start = currentScreen->clipBound_X1;
-                    if (edge->start > currentScreen->clipBound_X2)
-                        edge->start = currentScreen->clipBound_X2;
+        case INK_ADD:
+        case INK_SUB:
+            if (alpha > 0xFF)
+                alpha = 0xFF;
+            else if (alpha <= 0)
+                return;
+            break;
 
-                    if (edge->end < currentScreen->clipBound_X1)
-                        edge->end = currentScreen->clipBound_X1;
-                    if (edge->end > currentScreen->clipBound_X2)
-                        edge->end = currentScreen->clipBound_X2;
-
-                    int32 count = edge->end - edge->start;
-                    for (int32 x = 0; x < count; ++x) {
-                        frameBuffer[edge->start + x] = color16;
-                    }
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
-
-            case INK_BLEND:
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    if (edge->start < currentScreen->clipBound_X1)
-                        edge->start = currentScreen->clipBound_X1;
-                    if (edge->start > currentScreen->clipBound_X2)
-                        edge->start = currentScreen->clipBound_X2;
-
-                    if (edge->end < currentScreen->clipBound_X1)
-                        edge->end = currentScreen->clipBound_X1;
-                    if (edge->end > currentScreen->clipBound_X2)
-                        edge->end = currentScreen->clipBound_X2;
-
-                    int32 count = edge->end - edge->start;
-                    for (int32 x = 0; x < count; ++x) {
-                        setPixelBlend(color16, frameBuffer[edge->start + x]);
-                    }
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
-
-            case INK_ALPHA: {
-                uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    if (edge->start < currentScreen->clipBound_X1)
-                        edge->start = currentScreen->clipBound_X1;
-                    if (edge->start > currentScreen->clipBound_X2)
-                        edge->start = currentScreen->clipBound_X2;
-
-                    if (edge->end < currentScreen->clipBound_X1)
-                        edge->end = currentScreen->clipBound_X1;
-                    if (edge->end > currentScreen->clipBound_X2)
-                        edge->end = currentScreen->clipBound_X2;
-
-                    int32 count = edge->end - edge->start;
-                    for (int32 x = 0; x < count; ++x) {
-                        setPixelAlpha(color16, frameBuffer[edge->start + x], alpha);
-                    }
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
-            }
-
-            case INK_ADD: {
-                uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    if (edge->start < currentScreen->clipBound_X1)
-                        edge->start = currentScreen->clipBound_X1;
-                    if (edge->start > currentScreen->clipBound_X2)
-                        edge->start = currentScreen->clipBound_X2;
-
-                    if (edge->end < currentScreen->clipBound_X1)
-                        edge->end = currentScreen->clipBound_X1;
-                    if (edge->end > currentScreen->clipBound_X2)
-                        edge->end = currentScreen->clipBound_X2;
-
-                    int32 count = edge->end - edge->start;
-                    for (int32 x = 0; x < count; ++x) {
-                        setPixelAdditive(color16, frameBuffer[edge->start + x]);
-                    }
-
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
-            }
-
-            case INK_SUB: {
-                uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    if (edge->start < currentScreen->clipBound_X1)
-                        edge->start = currentScreen->clipBound_X1;
-                    if (edge->start > currentScreen->clipBound_X2)
-                        edge->start = currentScreen->clipBound_X2;
-
-                    if (edge->end < currentScreen->clipBound_X1)
-                        edge->end = currentScreen->clipBound_X1;
-                    if (edge->end > currentScreen->clipBound_X2)
-                        edge->end = currentScreen->clipBound_X2;
-
-                    int32 count = edge->end - edge->start;
-                    for (int32 x = 0; x < count; ++x) {
-                        setPixelSubtractive(color16, frameBuffer[edge->start + x]);
-                    }
-
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
-            }
-
-            case INK_TINT:
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    if (edge->start < currentScreen->clipBound_X1)
-                        edge->start = currentScreen->clipBound_X1;
-                    if (edge->start > currentScreen->clipBound_X2)
-                        edge->start = currentScreen->clipBound_X2;
-
-                    if (edge->end < currentScreen->clipBound_X1)
-                        edge->end = currentScreen->clipBound_X1;
-                    if (edge->end > currentScreen->clipBound_X2)
-                        edge->end = currentScreen->clipBound_X2;
-
-                    int32 count = edge->end - edge->start;
-                    for (int32 x = 0; x < count; ++x) {
-                        frameBuffer[edge->start + x] = tintLookupTable[frameBuffer[edge->start + x]];
-                    }
-
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
-
-            case INK_MASKED:
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    if (edge->start < currentScreen->clipBound_X1)
-                        edge->start = currentScreen->clipBound_X1;
-                    if (edge->start > currentScreen->clipBound_X2)
-                        edge->start = currentScreen->clipBound_X2;
-
-                    if (edge->end < currentScreen->clipBound_X1)
-                        edge->end = currentScreen->clipBound_X1;
-                    if (edge->end > currentScreen->clipBound_X2)
-                        edge->end = currentScreen->clipBound_X2;
-
-                    int32 count = edge->end - edge->start;
-                    for (int32 x = 0; x < count; ++x) {
-                        if (frameBuffer[edge->start + x] == maskColor)
-                            frameBuffer[edge->start + x] = color16;
-                    }
-
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
-
-            case INK_UNMASKED:
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    if (edge->start < currentScreen->clipBound_X1)
-                        edge->start = currentScreen->clipBound_X1;
-                    if (edge->start > currentScreen->clipBound_X2)
-                        edge->start = currentScreen->clipBound_X2;
-
-                    if (edge->end < currentScreen->clipBound_X1)
-                        edge->end = currentScreen->clipBound_X1;
-                    if (edge->end > currentScreen->clipBound_X2)
-                        edge->end = currentScreen->clipBound_X2;
-
-                    int32 count = edge->end - edge->start;
-                    for (int32 x = 0; x < count; ++x) {
-                        if (frameBuffer[edge->start + x] != maskColor)
-                            frameBuffer[edge->start + x] = color16;
-                    }
-
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
-        }
-    }
-}
-void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, int32 alpha, int32 inkEffect)
-{
-    switch (inkEffect) {
-        default: break;
-        case INK_ALPHA:
-            if (alpha > 0xFF)
-                inkEffect = INK_NONE;
-            else if (alpha <= 0)
-                return;
-            break;
-
-        case INK_ADD:
-        case INK_SUB:
-            if (alpha > 0xFF)
-                alpha = 0xFF;
-            else if (alpha <= 0)
-                return;
-            break;
-
-        case INK_TINT:
-            if (!tintLookupTable)
-                return;
-            break;
-    }
+        case INK_TINT:
+            if (!tintLookupTable)
+                return;
+            break;
+    }
 
     int32 top    = 0x7FFFFFFF;
     int32 bottom = -0x10000;
@@ -2293,6 +2024,12 @@ void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, i
                 break;
 
             case INK_BLEND:
+            case INK_ALPHA:
+            case INK_ADD:
+            case INK_SUB: {
+                // interpolate the span into a colour line first so the span kernels can blend it in one go
+                uint16 colorLine[SCREEN_XMAX];
+
                 for (int32 s = topScreen; s <= bottomScreen; ++s) {
                     int32 start  = edge->start;
                     int32 count  = edge->end - edge->start;
@@ -2329,27 +2066,31 @@ void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, i
                         count     = currentScreen->clipBound_X2 - edge->start;
                     }
 
-                    for (int32 x = 0; x < count; ++x) {
-                        uint16 color = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
-                        setPixelBlend(color, frameBuffer[edge->start + x]);
+                    if (count > 0) {
+                        for (int32 x = 0; x < count; ++x) {
+                            colorLine[x] = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
 
-                        startR += deltaR;
-                        startG += deltaG;
-                        startB += deltaB;
+                            startR += deltaR;
+                            startG += deltaG;
+                            startB += deltaB;
+                        }
+
+                        DrawInkSpan(&frameBuffer[edge->start], colorLine, NULL, count, inkEffect, alpha);
                     }
 
                     ++edge;
                     frameBuffer += currentScreen->pitch;
                 }
                 break;
+            }
 
-            case INK_ALPHA: {
-                uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
+            case INK_TINT:
                 for (int32 s = topScreen; s <= bottomScreen; ++s) {
                     int32 start  = edge->start;
                     int32 count  = edge->end - edge->start;
+
+#if RETRO_USE_ORIGINAL_CODE
+                    // Unused, ifdef'd out to help out ports for weaker hardware
                     int32 deltaR = 0;
                     int32 deltaG = 0;
                     int32 deltaB = 0;
@@ -2361,15 +2102,20 @@ void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, i
                     int32 startR = edge->startR;
                     int32 startG = edge->startG;
                     int32 startB = edge->startB;
+#endif
 
                     if (start > currentScreen->clipBound_X2) {
                         edge->start = currentScreen->clipBound_X2;
                     }
 
                     if (start < currentScreen->clipBound_X1) {
+#if RETRO_USE_ORIGINAL_CODE
+                        // Unused, ifdef'd out to help out ports for weaker hardware
                         startR += deltaR * (currentScreen->clipBound_X1 - edge->start);
                         startG += deltaG * (currentScreen->clipBound_X1 - edge->start);
                         startB += deltaB * (currentScreen->clipBound_X1 - edge->start);
+#endif
+
                         count -= (currentScreen->clipBound_X1 - edge->start);
                         edge->start = currentScreen->clipBound_X1;
                     }
@@ -2384,22 +2130,22 @@ void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, i
                     }
 
                     for (int32 x = 0; x < count; ++x) {
-                        uint16 color = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
-                        setPixelAlpha(color, frameBuffer[edge->start + x], alpha);
+                        frameBuffer[edge->start + x] = tintLookupTable[frameBuffer[edge->start + x]];
 
+#if RETRO_USE_ORIGINAL_CODE
+                        // Unused, ifdef'd out to help out ports for weaker hardware
                         startR += deltaR;
                         startG += deltaG;
                         startB += deltaB;
+#endif
                     }
+
                     ++edge;
                     frameBuffer += currentScreen->pitch;
                 }
                 break;
-            }
-
-            case INK_ADD: {
-                uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
 
+            case INK_MASKED:
                 for (int32 s = topScreen; s <= bottomScreen; ++s) {
                     int32 start  = edge->start;
                     int32 count  = edge->end - edge->start;
@@ -2427,18 +2173,14 @@ void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, i
                         edge->start = currentScreen->clipBound_X1;
                     }
 
-                    if (edge->end < currentScreen->clipBound_X1) {
-                        edge->end = currentScreen->clipBound_X1;
-                    }
-
-                    if (edge->end > currentScreen->clipBound_X2) {
+                    if (edge->end < currentScreen->clipBound_X1 || edge->end > currentScreen->clipBound_X2) {
                         edge->end = currentScreen->clipBound_X2;
                         count     = currentScreen->clipBound_X2 - edge->start;
                     }
 
                     for (int32 x = 0; x < count; ++x) {
-                        uint16 color = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
-                        setPixelAdditive(color, frameBuffer[edge->start + x]);
+                        if (frameBuffer[edge->start + x] == maskColor)
+                            frameBuffer[edge->start + x] = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
 
                         startR += deltaR;
                         startG += deltaG;
@@ -2449,11 +2191,8 @@ void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, i
                     frameBuffer += currentScreen->pitch;
                 }
                 break;
-            }
-
-            case INK_SUB: {
-                uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
 
+            case INK_UNMASKED:
                 for (int32 s = topScreen; s <= bottomScreen; ++s) {
                     int32 start  = edge->start;
                     int32 count  = edge->end - edge->start;
@@ -2491,8 +2230,8 @@ void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, i
                     }
 
                     for (int32 x = 0; x < count; ++x) {
-                        uint16 color = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
-                        setPixelSubtractive(color, frameBuffer[edge->start + x]);
+                        if (frameBuffer[edge->start + x] != maskColor)
+                            frameBuffer[edge->start + x] = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
 
                         startR += deltaR;
                         startG += deltaG;
@@ -2503,168 +2242,352 @@ void RSDK::DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, i
                     frameBuffer += currentScreen->pitch;
                 }
                 break;
-            }
-
-            case INK_TINT:
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    int32 start  = edge->start;
-                    int32 count  = edge->end - edge->start;
+        }
+    }
+}
 
-#if RETRO_USE_ORIGINAL_CODE
-                    // Unused, ifdef'd out to help out ports for weaker hardware
-                    int32 deltaR = 0;
-                    int32 deltaG = 0;
-                    int32 deltaB = 0;
-                    if (count > 0) {
-                        deltaR = (edge->endR - edge->startR) / count;
-                        deltaG = (edge->endG - edge->startG) / count;
-                        deltaB = (edge->endB - edge->startB) / count;
-                    }
-                    int32 startR = edge->startR;
-                    int32 startG = edge->startG;
-                    int32 startB = edge->startB;
-#endif
+#define FACEBATCH_TILE_W   (64)
+#define FACEBATCH_TILE_H   (32)
+#define FACEBATCH_JOB_MIN  (32) // any less than this & it's not worth farming the tiles out to the thread pool
 
-                    if (start > currentScreen->clipBound_X2) {
-                        edge->start = currentScreen->clipBound_X2;
-                    }
+struct FaceBatchSpan {
+    int16 start;
+    int16 end;
+};
 
-                    if (start < currentScreen->clipBound_X1) {
-#if RETRO_USE_ORIGINAL_CODE
-                        // Unused, ifdef'd out to help out ports for weaker hardware
-                        startR += deltaR * (currentScreen->clipBound_X1 - edge->start);
-                        startG += deltaG * (currentScreen->clipBound_X1 - edge->start);
-                        startB += deltaB * (currentScreen->clipBound_X1 - edge->start);
-#endif
+struct FaceBatchEntry {
+    uint16 color;
+    int32 top;
+    int32 bottom;
+    int32 left;
+    int32 right;
+    int32 spanOffset;
+};
 
-                        count -= (currentScreen->clipBound_X1 - edge->start);
-                        edge->start = currentScreen->clipBound_X1;
-                    }
+struct FaceBatch {
+    std::vector<FaceBatchEntry> faces;
+    std::vector<FaceBatchSpan> spans;
+    std::vector<std::vector<int32>> tileFaces;
+    JobGroup group;
+
+    ScreenInfo *screen;
+    int32 clipX1;
+    int32 clipY1;
+    int32 clipX2;
+    int32 clipY2;
+    int32 tilesX;
+    int32 tilesY;
+
+    int32 alpha;
+    int32 inkEffect;
+    bool32 active;
+};
 
-                    if (edge->end < currentScreen->clipBound_X1) {
-                        edge->end = currentScreen->clipBound_X1;
-                    }
+FaceBatch faceBatch;
 
-                    if (edge->end > currentScreen->clipBound_X2) {
-                        edge->end = currentScreen->clipBound_X2;
-                        count     = currentScreen->clipBound_X2 - edge->start;
-                    }
+bool32 RSDK::BeginFaceBatch(int32 alpha, int32 inkEffect)
+{
+    faceBatch.active = false;
 
-                    for (int32 x = 0; x < count; ++x) {
-                        frameBuffer[edge->start + x] = tintLookupTable[frameBuffer[edge->start + x]];
+    // same checks DrawFace does
+    switch (inkEffect) {
+        default: break;
+        case INK_ALPHA:
+            if (alpha > 0xFF)
+                inkEffect = INK_NONE;
+            else if (alpha <= 0)
+                return false;
+            break;
 
-#if RETRO_USE_ORIGINAL_CODE
-                        // Unused, ifdef'd out to help out ports for weaker hardware
-                        startR += deltaR;
-                        startG += deltaG;
-                        startB += deltaB;
-#endif
-                    }
+        case INK_ADD:
+        case INK_SUB:
+            if (alpha > 0xFF)
+                alpha = 0xFF;
+            else if (alpha <= 0)
+                return false;
+            break;
 
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
+        case INK_TINT:
+            if (!tintLookupTable)
+                return false;
+            break;
+    }
 
-            case INK_MASKED:
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    int32 start  = edge->start;
-                    int32 count  = edge->end - edge->start;
-                    int32 deltaR = 0;
-                    int32 deltaG = 0;
-                    int32 deltaB = 0;
-                    if (count > 0) {
-                        deltaR = (edge->endR - edge->startR) / count;
-                        deltaG = (edge->endG - edge->startG) / count;
-                        deltaB = (edge->endB - edge->startB) / count;
-                    }
-                    int32 startR = edge->startR;
-                    int32 startG = edge->startG;
-                    int32 startB = edge->startB;
+    faceBatch.screen    = currentScreen;
+    faceBatch.clipX1    = currentScreen->clipBound_X1;
+    faceBatch.clipY1    = currentScreen->clipBound_Y1;
+    faceBatch.clipX2    = currentScreen->clipBound_X2;
+    faceBatch.clipY2    = currentScreen->clipBound_Y2;
+    faceBatch.tilesX    = (currentScreen->size.x + FACEBATCH_TILE_W - 1) / FACEBATCH_TILE_W;
+    faceBatch.tilesY    = (currentScreen->size.y + FACEBATCH_TILE_H - 1) / FACEBATCH_TILE_H;
+    faceBatch.alpha     = alpha;
+    faceBatch.inkEffect = inkEffect;
+
+    faceBatch.faces.clear();
+    faceBatch.spans.clear();
+    if ((int32)faceBatch.tileFaces.size() < faceBatch.tilesX * faceBatch.tilesY)
+        faceBatch.tileFaces.resize(faceBatch.tilesX * faceBatch.tilesY);
+    for (auto &list : faceBatch.tileFaces) list.clear();
+
+    faceBatch.active = true;
+    return true;
+}
 
-                    if (start > currentScreen->clipBound_X2) {
-                        edge->start = currentScreen->clipBound_X2;
-                    }
+void RSDK::AddFaceToBatch(Vector2 *vertices, int32 vertCount, int32 r, int32 g, int32 b)
+{
+    if (!faceBatch.active)
+        return;
 
-                    if (start < currentScreen->clipBound_X1) {
-                        startR += deltaR * (currentScreen->clipBound_X1 - edge->start);
-                        startG += deltaG * (currentScreen->clipBound_X1 - edge->start);
-                        startB += deltaB * (currentScreen->clipBound_X1 - edge->start);
-                        count -= (currentScreen->clipBound_X1 - edge->start);
-                        edge->start = currentScreen->clipBound_X1;
-                    }
+    int32 top    = 0x7FFFFFFF;
+    int32 bottom = -0x10000;
+    for (int32 v = 0; v < vertCount; ++v) {
+        if (vertices[v].y < top)
+            top = vertices[v].y;
+        if (vertices[v].y > bottom)
+            bottom = vertices[v].y;
+    }
 
-                    if (edge->end < currentScreen->clipBound_X1 || edge->end > currentScreen->clipBound_X2) {
-                        edge->end = currentScreen->clipBound_X2;
-                        count     = currentScreen->clipBound_X2 - edge->start;
-                    }
+    int32 topScreen    = CLAMP(FROM_FIXED(top), faceBatch.clipY1, faceBatch.clipY2);
+    int32 bottomScreen = CLAMP(FROM_FIXED(bottom), faceBatch.clipY1, faceBatch.clipY2);
+    if (topScreen == bottomScreen)
+        return;
 
-                    for (int32 x = 0; x < count; ++x) {
-                        if (frameBuffer[edge->start + x] == maskColor)
-                            frameBuffer[edge->start + x] = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
+    // the edges are worked out exactly like DrawFace does, they're just stored for later instead of being filled right away
+    ScanEdge *edge = &scanEdgeBuffer[topScreen];
+    for (int32 s = topScreen; s <= bottomScreen; ++s) {
+        edge->start = 0x7FFF;
+        edge->end   = -1;
+        ++edge;
+    }
 
-                        startR += deltaR;
-                        startG += deltaG;
-                        startB += deltaB;
-                    }
+    for (int32 v = 0; v < vertCount - 1; ++v) {
+        ProcessScanEdge(vertices[v + 0].x, vertices[v + 0].y, vertices[v + 1].x, vertices[v + 1].y);
+    }
+    ProcessScanEdge(vertices[0].x, vertices[0].y, vertices[vertCount - 1].x, vertices[vertCount - 1].y);
+
+    FaceBatchEntry face;
+    face.color      = rgb32To16_B[b] | rgb32To16_G[g] | rgb32To16_R[r];
+    face.top        = topScreen;
+    face.bottom     = bottomScreen;
+    face.left       = faceBatch.clipX2;
+    face.right      = faceBatch.clipX1;
+    face.spanOffset = (int32)faceBatch.spans.size();
+
+    edge = &scanEdgeBuffer[topScreen];
+    for (int32 s = topScreen; s <= bottomScreen; ++s) {
+        FaceBatchSpan span;
+        span.start = CLAMP(edge->start, faceBatch.clipX1, faceBatch.clipX2);
+        span.end   = CLAMP(edge->end, faceBatch.clipX1, faceBatch.clipX2);
+        if (span.end > span.start) {
+            face.left  = MIN(face.left, span.start);
+            face.right = MAX(face.right, span.end);
+        }
 
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
+        faceBatch.spans.push_back(span);
+        ++edge;
+    }
+
+    if (face.right <= face.left) {
+        // nothing would've been drawn anyway
+        faceBatch.spans.resize(face.spanOffset);
+        return;
+    }
+
+    int32 faceID = (int32)faceBatch.faces.size();
+    faceBatch.faces.push_back(face);
+
+    int32 tileLeft   = face.left / FACEBATCH_TILE_W;
+    int32 tileRight  = (face.right - 1) / FACEBATCH_TILE_W;
+    int32 tileTop    = face.top / FACEBATCH_TILE_H;
+    int32 tileBottom = MIN(face.bottom / FACEBATCH_TILE_H, faceBatch.tilesY - 1);
+    for (int32 ty = tileTop; ty <= tileBottom; ++ty) {
+        for (int32 tx = tileLeft; tx <= tileRight; ++tx) faceBatch.tileFaces[tx + ty * faceBatch.tilesX].push_back(faceID);
+    }
+}
+
+void DrawFaceBatchTile(int32 tx, int32 ty)
+{
+    int32 x1 = MAX(tx * FACEBATCH_TILE_W, faceBatch.clipX1);
+    int32 x2 = MIN((tx + 1) * FACEBATCH_TILE_W, faceBatch.clipX2);
+    int32 y1 = MAX(ty * FACEBATCH_TILE_H, faceBatch.clipY1);
+    // DrawFace fills down to clipY2 itself (unlike clipX2), that last line just can't go past the bottom of the screen
+    int32 y2 = MIN((ty + 1) * FACEBATCH_TILE_H, MIN(faceBatch.clipY2 + 1, faceBatch.screen->size.y));
+    if (x1 >= x2 || y1 >= y2)
+        return;
+
+    std::vector<int32> &list = faceBatch.tileFaces[tx + ty * faceBatch.tilesX];
+    int32 first              = 0;
+
+    // with no blending, anything behind the nearest face that covers the entire tile will be drawn over anyway
+    // the scan edges stop short of clipY2, so that line never has anything in it to cover
+    int32 coverY2 = MIN(y2, faceBatch.clipY2);
+    if (faceBatch.inkEffect == INK_NONE && y1 < coverY2) {
+        for (int32 f = (int32)list.size() - 1; f > 0; --f) {
+            FaceBatchEntry *face = &faceBatch.faces[list[f]];
+            if (face->left > x1 || face->right < x2 || face->top > y1 || face->bottom < coverY2 - 1)
+                continue;
+
+            FaceBatchSpan *span = &faceBatch.spans[face->spanOffset + (y1 - face->top)];
+            int32 y             = y1;
+            for (; y < coverY2; ++y, ++span) {
+                if (span->start > x1 || span->end < x2)
+                    break;
+            }
+
+            if (y == coverY2) {
+                first = f;
                 break;
+            }
+        }
+    }
 
-            case INK_UNMASKED:
-                for (int32 s = topScreen; s <= bottomScreen; ++s) {
-                    int32 start  = edge->start;
-                    int32 count  = edge->end - edge->start;
-                    int32 deltaR = 0;
-                    int32 deltaG = 0;
-                    int32 deltaB = 0;
-                    if (count > 0) {
-                        deltaR = (edge->endR - edge->startR) / count;
-                        deltaG = (edge->endG - edge->startG) / count;
-                        deltaB = (edge->endB - edge->startB) / count;
-                    }
-                    int32 startR = edge->startR;
-                    int32 startG = edge->startG;
-                    int32 startB = edge->startB;
+    int32 alpha           = CLAMP(faceBatch.alpha, 0x00, 0xFF);
+    uint16 *fbufferBlend  = &blendLookupTable[0x20 * (0xFF - alpha)];
+    uint16 *pixelBlend    = &blendLookupTable[0x20 * alpha];
+    uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
+    uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
+    int32 pitch           = faceBatch.screen->pitch;
+
+    for (int32 f = first; f < (int32)list.size(); ++f) {
+        FaceBatchEntry *face = &faceBatch.faces[list[f]];
+        uint16 color16       = face->color;
+
+        int32 top           = MAX(face->top, y1);
+        int32 bottom        = MIN(face->bottom + 1, y2);
+        FaceBatchSpan *span = &faceBatch.spans[face->spanOffset + (top - face->top)];
+        uint16 *frameBuffer = &faceBatch.screen->frameBuffer[top * pitch];
+        for (int32 y = top; y < bottom; ++y, ++span, frameBuffer += pitch) {
+            int32 start = MAX(span->start, x1);
+            int32 count = MIN(span->end, x2) - start;
+
+            uint16 *pixels = &frameBuffer[start];
+            switch (faceBatch.inkEffect) {
+                default: break;
 
-                    if (start > currentScreen->clipBound_X2) {
-                        edge->start = currentScreen->clipBound_X2;
+                case INK_NONE:
+                    for (int32 x = 0; x < count; ++x) pixels[x] = color16;
+                    break;
+
+                case INK_BLEND:
+                    for (int32 x = 0; x < count; ++x) {
+                        setPixelBlend(color16, pixels[x]);
                     }
+                    break;
 
-                    if (start < currentScreen->clipBound_X1) {
-                        startR += deltaR * (currentScreen->clipBound_X1 - edge->start);
-                        startG += deltaG * (currentScreen->clipBound_X1 - edge->start);
-                        startB += deltaB * (currentScreen->clipBound_X1 - edge->start);
-                        count -= (currentScreen->clipBound_X1 - edge->start);
-                        edge->start = currentScreen->clipBound_X1;
+                case INK_ALPHA:
+                    for (int32 x = 0; x < count; ++x) {
+                        setPixelAlpha(color16, pixels[x], alpha);
                     }
+                    break;
 
-                    if (edge->end < currentScreen->clipBound_X1) {
-                        edge->end = currentScreen->clipBound_X1;
+                case INK_ADD:
+                    for (int32 x = 0; x < count; ++x) {
+                        setPixelAdditive(color16, pixels[x]);
                     }
+                    break;
 
-                    if (edge->end > currentScreen->clipBound_X2) {
-                        edge->end = currentScreen->clipBound_X2;
-                        count     = currentScreen->clipBound_X2 - edge->start;
+                case INK_SUB:
+                    for (int32 x = 0; x < count; ++x) {
+                        setPixelSubtractive(color16, pixels[x]);
                     }
+                    break;
+
+                case INK_TINT:
+                    for (int32 x = 0; x < count; ++x) pixels[x] = tintLookupTable[pixels[x]];
+                    break;
 
+                case INK_MASKED:
                     for (int32 x = 0; x < count; ++x) {
-                        if (frameBuffer[edge->start + x] != maskColor)
-                            frameBuffer[edge->start + x] = (startB >> 19) + ((startG >> 13) & 0x7E0) + ((startR >> 8) & 0xF800);
+                        if (pixels[x] == maskColor)
+                            pixels[x] = color16;
+                    }
+                    break;
 
-                        startR += deltaR;
-                        startG += deltaG;
-                        startB += deltaB;
+                case INK_UNMASKED:
+                    for (int32 x = 0; x < count; ++x) {
+                        if (pixels[x] != maskColor)
+                            pixels[x] = color16;
                     }
+                    break;
+            }
+        }
+    }
+}
 
-                    ++edge;
-                    frameBuffer += currentScreen->pitch;
-                }
-                break;
+void RSDK::DrawFaceBatch()
+{
+    FlushPendingDraws();
+
+    if (!faceBatch.active)
+        return;
+
+    faceBatch.active = false;
+    if (faceBatch.faces.empty())
+        return;
+
+    // tiles never overlap, so each row of them can be filled on its own thread
+    if (faceBatch.faces.size() < FACEBATCH_JOB_MIN) {
+        for (int32 ty = 0; ty < faceBatch.tilesY; ++ty) {
+            for (int32 tx = 0; tx < faceBatch.tilesX; ++tx) DrawFaceBatchTile(tx, ty);
+        }
+    }
+    else {
+        for (int32 ty = 0; ty < faceBatch.tilesY; ++ty) {
+            RunJob(&faceBatch.group, [ty] {
+                for (int32 tx = 0; tx < faceBatch.tilesX; ++tx) DrawFaceBatchTile(tx, ty);
+            });
+        }
+
+        WaitForJobGroup(&faceBatch.group);
+    }
+}
+
+void RSDK::DrawIndexedLine(uint16 *frameBuffer, const uint8 *indices, int32 count, const uint16 *palette)
+{
+    int32 i = 0;
+
+    // check a chunk of indices at once, fully transparent chunks are skipped & fully opaque ones are written without any per-pixel tests
+#if RETRO_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        int32 mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)&indices[i]), zero));
+        if (mask == 0xFFFF)
+            continue;
+
+        if (!mask) {
+            for (int32 p = 0; p < 16; ++p) frameBuffer[i + p] = palette[indices[i + p]];
+        }
+        else {
+            for (int32 p = 0; p < 16; ++p) {
+                if (!(mask & (1 << p)))
+                    frameBuffer[i + p] = palette[indices[i + p]];
+            }
         }
     }
+#else
+    for (; i + 8 <= count; i += 8) {
+        uint64 chunk = 0;
+        memcpy(&chunk, &indices[i], sizeof(chunk));
+        if (!chunk)
+            continue;
+
+        // classic "has a zero byte" test
+        if (!((chunk - 0x0101010101010101ULL) & ~chunk & 0x8080808080808080ULL)) {
+            for (int32 p = 0; p < 8; ++p) frameBuffer[i + p] = palette[indices[i + p]];
+        }
+        else {
+            for (int32 p = 0; p < 8; ++p) {
+                if (indices[i + p])
+                    frameBuffer[i + p] = palette[indices[i + p]];
+            }
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (indices[i])
+            frameBuffer[i] = palette[indices[i]];
+    }
 }
 
 void RSDK::DrawSprite(Animator *animator, Vector2 *position, bool32 screenRelative)
@@ -2851,665 +2774,520 @@ void RSDK::DrawSprite(Animator *animator, Vector2 *position, bool32 screenRelati
         }
     }
 }
-void RSDK::DrawSpriteFlipped(int32 x, int32 y, int32 width, int32 height, int32 sprX, int32 sprY, int32 direction, int32 inkEffect, int32 alpha,
-                             int32 sheetID)
+void RSDK::BuildSurfaceRuns(GFXSurface *surface)
 {
-    switch (inkEffect) {
+    ClearSurfaceRuns(surface);
+    if (!surface->pixels || surface->width <= 0 || surface->height <= 0)
+        return;
+
+    // count everything up first so the table can be allocated in one go
+    int32 runCount    = 0;
+    int32 opaqueCount = 0;
+    uint8 *pixels     = surface->pixels;
+    for (int32 y = 0; y < surface->height; ++y) {
+        bool32 opaque = false;
+        for (int32 x = 0; x < surface->width; ++x, ++pixels) {
+            if (*pixels) {
+                runCount += !opaque;
+                ++opaqueCount;
+            }
+            opaque = *pixels != 0;
+        }
+    }
+
+    // noisy sheets don't gain much from runs, so they're left without a table
+    // this also keeps the table under half the size of the sheet's opaque pixels, since it lives in stage storage
+    if (opaqueCount < runCount * 8)
+        return;
+
+    AllocateStorage((void **)&surface->runTable, sizeof(uint32) * surface->height + sizeof(uint16) * (surface->height + 2 * runCount), DATASET_STG,
+                    false);
+    if (!surface->runTable)
+        return;
+
+    uint16 *runs  = (uint16 *)&surface->runTable[surface->height];
+    uint32 offset = 0;
+    pixels        = surface->pixels;
+    for (int32 y = 0; y < surface->height; ++y) {
+        surface->runTable[y] = offset;
+
+        uint16 *lineRuns = &runs[offset++];
+        *lineRuns        = 0;
+
+        int32 x = 0;
+        while (x < surface->width) {
+            int32 skip = 0;
+            while (x < surface->width && !pixels[x]) {
+                ++skip;
+                ++x;
+            }
+
+            int32 length = 0;
+            while (x < surface->width && pixels[x]) {
+                ++length;
+                ++x;
+            }
+
+            if (length) {
+                runs[offset++] = skip;
+                runs[offset++] = length;
+                ++*lineRuns;
+            }
+        }
+
+        pixels += surface->width;
+    }
+}
+
+void RSDK::ClearSurfaceRuns(GFXSurface *surface)
+{
+    if (surface->runTable)
+        RemoveStorageEntry((void **)&surface->runTable);
+
+    surface->runTable = NULL;
+}
+
+// Sprite blitters
+// every sprite drawer samples a line of palette indices from its sheet & hands it to CompositeSpriteLine to draw
+// ink effects & flips are template parameters, so each instantiation folds down to just the loop it needs
+// index 0 is transparent, unless Transparent is false, in which case the caller already knows every index in the line is opaque
+template <int32 InkEffect, bool32 Transparent = true>
+inline void CompositeSpriteLine(uint16 *frameBuffer, const uint8 *indices, int32 count, uint16 *activePalette, int32 alpha)
+{
+    switch (InkEffect) {
         default: break;
-        case INK_ALPHA:
-            if (alpha > 0xFF)
-                inkEffect = INK_NONE;
-            else if (alpha <= 0)
-                return;
+
+        case INK_NONE:
+            if (Transparent)
+                DrawIndexedLine(frameBuffer, indices, count, activePalette);
+            else
+                for (int32 i = 0; i < count; ++i) frameBuffer[i] = activePalette[indices[i]];
             break;
 
+        case INK_BLEND:
+        case INK_ALPHA:
         case INK_ADD:
-        case INK_SUB:
-            if (alpha > 0xFF)
-                alpha = 0xFF;
-            else if (alpha <= 0)
-                return;
+        case INK_SUB: {
+            uint16 colors[SCREEN_XMAX];
+            for (int32 i = 0; i < count; ++i) colors[i] = activePalette[indices[i]];
+
+            DrawInkSpan(frameBuffer, colors, Transparent ? indices : NULL, count, InkEffect, alpha);
             break;
+        }
 
         case INK_TINT:
-            if (!tintLookupTable)
-                return;
+            for (int32 i = 0; i < count; ++i) {
+                if (!Transparent || indices[i])
+                    frameBuffer[i] = tintLookupTable[frameBuffer[i]];
+            }
+            break;
+
+        case INK_MASKED:
+            for (int32 i = 0; i < count; ++i) {
+                if ((!Transparent || indices[i]) && frameBuffer[i] == maskColor)
+                    frameBuffer[i] = activePalette[indices[i]];
+            }
+            break;
+
+        case INK_UNMASKED:
+            for (int32 i = 0; i < count; ++i) {
+                if ((!Transparent || indices[i]) && frameBuffer[i] != maskColor)
+                    frameBuffer[i] = activePalette[indices[i]];
+            }
             break;
     }
-    int32 widthFlip  = width;
-    int32 heightFlip = height;
+}
 
-    if (width + x > currentScreen->clipBound_X2)
-        width = currentScreen->clipBound_X2 - x;
+// PixelStep is 1 when drawing normally & -1 when flipped horizontally, lineStep is how far pixels moves per line (negative when flipped vertically)
+template <int32 InkEffect, int32 PixelStep>
+void BlitSpriteFlipped(uint16 *frameBuffer, uint8 *pixels, uint8 *lineBuffer, int32 width, int32 height, int32 lineStep, int32 alpha)
+{
+    uint8 indices[SCREEN_XMAX];
 
-    if (x < currentScreen->clipBound_X1) {
-        int32 val = x - currentScreen->clipBound_X1;
-        sprX -= val;
-        width += val;
-        widthFlip += 2 * val;
-        x = currentScreen->clipBound_X1;
+    while (height--) {
+        uint16 *activePalette = fullPalette[*lineBuffer];
+        lineBuffer++;
+
+        // unflipped lines can be composited straight from the sheet
+        if (PixelStep == 1) {
+            CompositeSpriteLine<InkEffect>(frameBuffer, pixels, width, activePalette, alpha);
+        }
+        else {
+            for (int32 i = 0; i < width; ++i) indices[i] = pixels[-i];
+            CompositeSpriteLine<InkEffect>(frameBuffer, indices, width, activePalette, alpha);
+        }
+
+        frameBuffer += currentScreen->pitch;
+        pixels += lineStep;
     }
+}
 
-    if (height + y > currentScreen->clipBound_Y2)
-        height = currentScreen->clipBound_Y2 - y;
+// same as BlitSpriteFlipped, but walks the sheet's run table so transparent spans are skipped wholesale & opaque ones are drawn without any tests
+// srcX is the first column drawn (the rightmost one when flipped) & lineStep is +1/-1 rows
+template <int32 InkEffect, int32 PixelStep>
+void BlitSpriteRuns(uint16 *frameBuffer, GFXSurface *surface, int32 srcX, int32 srcY, uint8 *lineBuffer, int32 width, int32 height, int32 lineStep,
+                    int32 alpha)
+{
+    uint8 indices[SCREEN_XMAX];
+    uint16 *runData = (uint16 *)&surface->runTable[surface->height];
+    int32 colStart  = PixelStep == 1 ? srcX : srcX - width + 1;
+    int32 colEnd    = colStart + width;
+
+    while (height--) {
+        uint16 *activePalette = fullPalette[*lineBuffer];
+        lineBuffer++;
+
+        uint8 *line    = &surface->pixels[surface->width * srcY];
+        uint16 *runs   = &runData[surface->runTable[srcY]];
+        int32 runCount = *runs++;
+
+        int32 pos = 0;
+        for (; runCount > 0; --runCount, runs += 2) {
+            int32 start = pos + runs[0];
+            int32 end   = start + runs[1];
+            pos         = end;
+
+            if (end <= colStart)
+                continue;
+            if (start >= colEnd)
+                break;
 
-    if (y < currentScreen->clipBound_Y1) {
-        int32 val = y - currentScreen->clipBound_Y1;
-        sprY -= val;
-        height += val;
-        heightFlip += 2 * val;
-        y = currentScreen->clipBound_Y1;
+            start = MAX(start, colStart);
+            end   = MIN(end, colEnd);
+
+            if (PixelStep == 1) {
+                CompositeSpriteLine<InkEffect, false>(&frameBuffer[start - colStart], &line[start], end - start, activePalette, alpha);
+            }
+            else {
+                for (int32 i = 0; i < end - start; ++i) indices[i] = line[end - 1 - i];
+                CompositeSpriteLine<InkEffect, false>(&frameBuffer[srcX - (end - 1)], indices, end - start, activePalette, alpha);
+            }
+        }
+
+        frameBuffer += currentScreen->pitch;
+        srcY += lineStep;
     }
+}
 
-    if (width <= 0 || height <= 0)
-        return;
+template <int32 InkEffect>
+void BlitSpriteRotozoom(uint16 *frameBuffer, uint8 *lineBuffer, GFXSurface *surface, int32 xSize, int32 ySize, SpriteRotozoom *rotozoom, int32 alpha)
+{
+    uint8 indices[SCREEN_XMAX];
+    uint8 *pixels  = surface->pixels;
+    int32 lineSize = surface->lineSize;
+    int32 drawX    = rotozoom->drawX;
+    int32 drawY    = rotozoom->drawY;
+
+    for (int32 y = 0; y < ySize; ++y) {
+        uint16 *activePalette = fullPalette[*lineBuffer++];
+        int32 drawXPos        = drawX;
+        int32 drawYPos        = drawY;
+        for (int32 x = 0; x < xSize; ++x) {
+            if (drawXPos >= rotozoom->fullSprX && drawXPos < rotozoom->fullX && drawYPos >= rotozoom->fullSprY && drawYPos < rotozoom->fullY)
+                indices[x] = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
+            else
+                indices[x] = 0;
+
+            drawXPos += rotozoom->deltaX;
+            drawYPos += rotozoom->deltaY;
+        }
 
-    GFXSurface *surface = &gfxSurface[sheetID];
-    validDraw           = true;
-    int32 pitch         = currentScreen->pitch - width;
-    int32 gfxPitch      = 0;
-    uint8 *lineBuffer   = NULL;
-    uint8 *pixels       = NULL;
-    uint16 *frameBuffer = NULL;
+        CompositeSpriteLine<InkEffect>(frameBuffer, indices, xSize, activePalette, alpha);
 
-    switch (direction) {
-        default: break;
+        drawX -= rotozoom->deltaXLen;
+        drawY += rotozoom->deltaYLen;
+        frameBuffer += currentScreen->pitch;
+    }
+}
 
-        case FLIP_NONE:
-            gfxPitch    = surface->width - width;
-            lineBuffer  = &gfxLineBuffer[y];
-            pixels      = &surface->pixels[sprX + surface->width * sprY];
-            frameBuffer = &currentScreen->frameBuffer[x + currentScreen->pitch * y];
-            switch (inkEffect) {
-                case INK_NONE:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                *frameBuffer = activePalette[*pixels];
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
+template <int32 InkEffect>
+void BlitSpriteDeformed(uint16 *frameBuffer, uint8 *lineBuffer, GFXSurface *surface, ScanlineInfo *scanline, int32 height, int32 alpha)
+{
+    uint8 indices[SCREEN_XMAX];
+    uint8 *pixels  = surface->pixels;
+    int32 lineSize = surface->lineSize;
+    int32 maskX    = surface->width - 1;
+    int32 maskY    = surface->height - 1;
+    int32 count    = currentScreen->pitch;
+
+    while (height--) {
+        uint16 *activePalette = fullPalette[*lineBuffer++];
+        int32 lx              = scanline->position.x;
+        int32 ly              = scanline->position.y;
+        int32 dx              = scanline->deform.x;
+        int32 dy              = scanline->deform.y;
+        for (int32 i = 0; i < count; ++i) {
+            indices[i] = pixels[((FROM_FIXED(ly) & maskY) << lineSize) + (FROM_FIXED(lx) & maskX)];
+            lx += dx;
+            ly += dy;
+        }
 
-                case INK_BLEND:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                setPixelBlend(activePalette[*pixels], *frameBuffer);
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
+        CompositeSpriteLine<InkEffect>(frameBuffer, indices, count, activePalette, alpha);
 
-                case INK_ALPHA: {
-                    uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                    uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelAlpha(color, *frameBuffer, alpha);
-                            }
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
-                }
+        frameBuffer += count;
+        ++scanline;
+    }
+}
 
-                case INK_ADD: {
-                    uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelAdditive(color, *frameBuffer);
-                            }
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
-                }
+typedef void (*SpriteFlippedBlitter)(uint16 *frameBuffer, uint8 *pixels, uint8 *lineBuffer, int32 width, int32 height, int32 lineStep, int32 alpha);
+typedef void (*SpriteRunBlitter)(uint16 *frameBuffer, GFXSurface *surface, int32 srcX, int32 srcY, uint8 *lineBuffer, int32 width, int32 height,
+                                 int32 lineStep, int32 alpha);
+typedef void (*SpriteRotozoomBlitter)(uint16 *frameBuffer, uint8 *lineBuffer, GFXSurface *surface, int32 xSize, int32 ySize, SpriteRotozoom *rotozoom,
+                                      int32 alpha);
+typedef void (*SpriteDeformedBlitter)(uint16 *frameBuffer, uint8 *lineBuffer, GFXSurface *surface, ScanlineInfo *scanline, int32 height, int32 alpha);
+
+// indexed by [inkEffect][flipX]
+SpriteFlippedBlitter spriteFlippedBlitters[INK_UNMASKED + 1][2] = {
+    { BlitSpriteFlipped<INK_NONE, 1>, BlitSpriteFlipped<INK_NONE, -1> },
+    { BlitSpriteFlipped<INK_BLEND, 1>, BlitSpriteFlipped<INK_BLEND, -1> },
+    { BlitSpriteFlipped<INK_ALPHA, 1>, BlitSpriteFlipped<INK_ALPHA, -1> },
+    { BlitSpriteFlipped<INK_ADD, 1>, BlitSpriteFlipped<INK_ADD, -1> },
+    { BlitSpriteFlipped<INK_SUB, 1>, BlitSpriteFlipped<INK_SUB, -1> },
+    { BlitSpriteFlipped<INK_TINT, 1>, BlitSpriteFlipped<INK_TINT, -1> },
+    { BlitSpriteFlipped<INK_MASKED, 1>, BlitSpriteFlipped<INK_MASKED, -1> },
+    { BlitSpriteFlipped<INK_UNMASKED, 1>, BlitSpriteFlipped<INK_UNMASKED, -1> },
+};
 
-                case INK_SUB: {
-                    uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelSubtractive(color, *frameBuffer);
-                            }
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
-                }
+SpriteRunBlitter spriteRunBlitters[INK_UNMASKED + 1][2] = {
+    { BlitSpriteRuns<INK_NONE, 1>, BlitSpriteRuns<INK_NONE, -1> },
+    { BlitSpriteRuns<INK_BLEND, 1>, BlitSpriteRuns<INK_BLEND, -1> },
+    { BlitSpriteRuns<INK_ALPHA, 1>, BlitSpriteRuns<INK_ALPHA, -1> },
+    { BlitSpriteRuns<INK_ADD, 1>, BlitSpriteRuns<INK_ADD, -1> },
+    { BlitSpriteRuns<INK_SUB, 1>, BlitSpriteRuns<INK_SUB, -1> },
+    { BlitSpriteRuns<INK_TINT, 1>, BlitSpriteRuns<INK_TINT, -1> },
+    { BlitSpriteRuns<INK_MASKED, 1>, BlitSpriteRuns<INK_MASKED, -1> },
+    { BlitSpriteRuns<INK_UNMASKED, 1>, BlitSpriteRuns<INK_UNMASKED, -1> },
+};
 
-                case INK_TINT:
-                    while (height--) {
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                *frameBuffer = tintLookupTable[*frameBuffer];
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
+SpriteRotozoomBlitter spriteRotozoomBlitters[INK_UNMASKED + 1] = {
+    BlitSpriteRotozoom<INK_NONE>, BlitSpriteRotozoom<INK_BLEND>, BlitSpriteRotozoom<INK_ALPHA>,  BlitSpriteRotozoom<INK_ADD>,
+    BlitSpriteRotozoom<INK_SUB>,  BlitSpriteRotozoom<INK_TINT>,  BlitSpriteRotozoom<INK_MASKED>, BlitSpriteRotozoom<INK_UNMASKED>,
+};
 
-                case INK_MASKED:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0 && *frameBuffer == maskColor)
-                                *frameBuffer = activePalette[*pixels];
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
+SpriteDeformedBlitter spriteDeformedBlitters[INK_UNMASKED + 1] = {
+    BlitSpriteDeformed<INK_NONE>, BlitSpriteDeformed<INK_BLEND>, BlitSpriteDeformed<INK_ALPHA>,  BlitSpriteDeformed<INK_ADD>,
+    BlitSpriteDeformed<INK_SUB>,  BlitSpriteDeformed<INK_TINT>,  BlitSpriteDeformed<INK_MASKED>, BlitSpriteDeformed<INK_UNMASKED>,
+};
 
-                case INK_UNMASKED:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0 && *frameBuffer != maskColor)
-                                *frameBuffer = activePalette[*pixels];
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
-            }
-            break;
+// Draw Commands
+bool32 RSDK::drawRecording    = false;
+int32 RSDK::drawCommandCount = 0;
+DrawCommand drawCommands[DRAWCOMMAND_COUNT];
 
-        case FLIP_X:
-            gfxPitch    = width + surface->width;
-            lineBuffer  = &gfxLineBuffer[y];
-            pixels      = &surface->pixels[widthFlip - 1 + sprX + surface->width * sprY];
-            frameBuffer = &currentScreen->frameBuffer[x + currentScreen->pitch * y];
-            switch (inkEffect) {
-                case INK_NONE:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                *frameBuffer = activePalette[*pixels];
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
+// screens are only split into bands when there's enough to draw to make it worth waking the pool up
+#define DRAWCOMMAND_BAND_MIN_COMMANDS (0x20)
+#define DRAWCOMMAND_BAND_MIN_HEIGHT   (0x20)
+// only this many opaque rects are checked against when looking for occluded commands
+#define DRAWCOMMAND_OCCLUDER_COUNT (0x10)
 
-                case INK_BLEND:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                setPixelBlend(activePalette[*pixels], *frameBuffer);
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
+DrawCommand *RSDK::AddDrawCommand(uint8 type, int32 left, int32 top, int32 width, int32 height, int32 inkEffect, int32 alpha)
+{
+    if (drawCommandCount >= DRAWCOMMAND_COUNT)
+        FlushDrawCommands();
+
+    DrawCommand *command = &drawCommands[drawCommandCount++];
+    command->type        = type;
+    command->inkEffect   = inkEffect;
+    command->alpha       = alpha;
+    command->left        = left;
+    command->top         = top;
+    command->width       = width;
+    command->height      = height;
+    return command;
+}
 
-                case INK_ALPHA: {
-                    uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                    uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelAlpha(color, *frameBuffer, alpha);
-                            }
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
-                }
+// draws the part of a command that falls between bandTop & bandBottom
+void DrawCommandBand(DrawCommand *command, int32 bandTop, int32 bandBottom)
+{
+    int32 top    = MAX(command->top, bandTop);
+    int32 bottom = MIN(command->top + command->height, bandBottom);
+    if (top >= bottom)
+        return;
 
-                case INK_ADD: {
-                    uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelAdditive(color, *frameBuffer);
-                            }
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
-                }
+    int32 skip          = top - command->top;
+    int32 height        = bottom - top;
+    uint16 *frameBuffer = &currentScreen->frameBuffer[command->left + top * currentScreen->pitch];
+    uint8 *lineBuffer   = &gfxLineBuffer[top];
 
-                case INK_SUB: {
-                    uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelSubtractive(color, *frameBuffer);
-                            }
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
-                }
+    switch (command->type) {
+        default: break;
 
-                case INK_TINT:
-                    while (height--) {
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                *frameBuffer = tintLookupTable[*frameBuffer];
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
+        case DRAWCMD_SPRITE:
+            spriteFlippedBlitters[command->inkEffect][command->flipX](frameBuffer, command->pixels + skip * command->lineStep, lineBuffer, command->width,
+                                                                      height, command->lineStep, command->alpha);
+            break;
 
-                case INK_MASKED:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0 && *frameBuffer == maskColor)
-                                *frameBuffer = activePalette[*pixels];
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
+        case DRAWCMD_SPRITERUNS:
+            spriteRunBlitters[command->inkEffect][command->flipX](frameBuffer, &gfxSurface[command->sheetID], command->srcX,
+                                                                  command->srcY + skip * command->lineStep, lineBuffer, command->width, height,
+                                                                  command->lineStep, command->alpha);
+            break;
 
-                case INK_UNMASKED:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0 && *frameBuffer != maskColor)
-                                *frameBuffer = activePalette[*pixels];
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels += gfxPitch;
-                    }
-                    break;
-            }
+        case DRAWCMD_SPRITEROTOZOOM: {
+            SpriteRotozoom rotozoom = command->rotozoom;
+            rotozoom.drawX -= skip * rotozoom.deltaXLen;
+            rotozoom.drawY += skip * rotozoom.deltaYLen;
+
+            spriteRotozoomBlitters[command->inkEffect](frameBuffer, lineBuffer, &gfxSurface[command->sheetID], command->width, height, &rotozoom,
+                                                       command->alpha);
             break;
+        }
 
-        case FLIP_Y:
-            gfxPitch    = width + surface->width;
-            lineBuffer  = &gfxLineBuffer[y];
-            pixels      = &surface->pixels[sprX + surface->width * (sprY + heightFlip - 1)];
-            frameBuffer = &currentScreen->frameBuffer[x + currentScreen->pitch * y];
-            switch (inkEffect) {
-                case INK_NONE:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                *frameBuffer = activePalette[*pixels];
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
+        case DRAWCMD_RECTANGLE: BlitRectangle(frameBuffer, command->width, height, command->color, command->inkEffect, command->alpha); break;
+    }
+}
 
-                case INK_BLEND:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                setPixelBlend(activePalette[*pixels], *frameBuffer);
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
+void RSDK::FlushDrawCommands()
+{
+    if (!drawCommandCount)
+        return;
 
-                case INK_ALPHA: {
-                    uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                    uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelAlpha(color, *frameBuffer, alpha);
-                            }
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
-                }
+    // anything that's completely covered by an opaque rect drawn after it doesn't need drawing at all
+    DrawCommand *occluders[DRAWCOMMAND_OCCLUDER_COUNT];
+    int32 occluderCount = 0;
+    for (int32 c = drawCommandCount - 1; c >= 0; --c) {
+        DrawCommand *command = &drawCommands[c];
+
+        for (int32 o = 0; o < occluderCount; ++o) {
+            DrawCommand *occluder = occluders[o];
+            if (command->left >= occluder->left && command->top >= occluder->top
+                && command->left + command->width <= occluder->left + occluder->width
+                && command->top + command->height <= occluder->top + occluder->height) {
+                command->height = 0;
+                break;
+            }
+        }
 
-                case INK_ADD: {
-                    uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelAdditive(color, *frameBuffer);
-                            }
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
-                }
+        if (command->height && command->type == DRAWCMD_RECTANGLE && command->inkEffect == INK_NONE && occluderCount < DRAWCOMMAND_OCCLUDER_COUNT)
+            occluders[occluderCount++] = command;
+    }
 
-                case INK_SUB: {
-                    uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelSubtractive(color, *frameBuffer);
-                            }
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
-                }
+    int32 bandCount = 1;
+    if (drawCommandCount >= DRAWCOMMAND_BAND_MIN_COMMANDS)
+        bandCount = MIN(GetThreadPoolWorkerCount() + 1, currentScreen->size.y / DRAWCOMMAND_BAND_MIN_HEIGHT);
+
+    if (bandCount > 1) {
+        // bands never overlap, so each one can draw every command in order without caring what the others are doing
+        int32 bandSize   = (currentScreen->size.y + bandCount - 1) / bandCount;
+        int32 count      = drawCommandCount;
+        JobGroup group;
+        for (int32 b = 0; b < bandCount; ++b) {
+            RunJob(&group, [b, bandSize, count]() {
+                for (int32 c = 0; c < count; ++c) DrawCommandBand(&drawCommands[c], b * bandSize, (b + 1) * bandSize);
+            });
+        }
+        WaitForJobGroup(&group);
+    }
+    else {
+        for (int32 c = 0; c < drawCommandCount; ++c) DrawCommandBand(&drawCommands[c], 0, SCREEN_YSIZE);
+    }
 
-                case INK_TINT:
-                    while (height--) {
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                *frameBuffer = tintLookupTable[*frameBuffer];
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
+    drawCommandCount = 0;
+}
 
-                case INK_MASKED:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0 && *frameBuffer == maskColor)
-                                *frameBuffer = activePalette[*pixels];
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
+void RSDK::DrawSpriteFlipped(int32 x, int32 y, int32 width, int32 height, int32 sprX, int32 sprY, int32 direction, int32 inkEffect, int32 alpha,
+                             int32 sheetID)
+{
+    switch (inkEffect) {
+        default: break;
+        case INK_ALPHA:
+            if (alpha > 0xFF)
+                inkEffect = INK_NONE;
+            else if (alpha <= 0)
+                return;
+            break;
 
-                case INK_UNMASKED:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0 && *frameBuffer != maskColor)
-                                *frameBuffer = activePalette[*pixels];
-                            ++pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
-            }
+        case INK_ADD:
+        case INK_SUB:
+            if (alpha > 0xFF)
+                alpha = 0xFF;
+            else if (alpha <= 0)
+                return;
+            break;
+
+        case INK_TINT:
+            if (!tintLookupTable)
+                return;
             break;
+    }
+    int32 widthFlip  = width;
+    int32 heightFlip = height;
+
+    if (width + x > currentScreen->clipBound_X2)
+        width = currentScreen->clipBound_X2 - x;
+
+    if (x < currentScreen->clipBound_X1) {
+        int32 val = x - currentScreen->clipBound_X1;
+        sprX -= val;
+        width += val;
+        widthFlip += 2 * val;
+        x = currentScreen->clipBound_X1;
+    }
 
-        case FLIP_XY:
-            gfxPitch    = surface->width - width;
-            lineBuffer  = &gfxLineBuffer[y];
-            pixels      = &surface->pixels[widthFlip - 1 + sprX + surface->width * (sprY + heightFlip - 1)];
-            frameBuffer = &currentScreen->frameBuffer[x + currentScreen->pitch * y];
-            switch (inkEffect) {
-                case INK_NONE:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                *frameBuffer = activePalette[*pixels];
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
+    if (height + y > currentScreen->clipBound_Y2)
+        height = currentScreen->clipBound_Y2 - y;
 
-                case INK_BLEND:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                setPixelBlend(activePalette[*pixels], *frameBuffer);
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
+    if (y < currentScreen->clipBound_Y1) {
+        int32 val = y - currentScreen->clipBound_Y1;
+        sprY -= val;
+        height += val;
+        heightFlip += 2 * val;
+        y = currentScreen->clipBound_Y1;
+    }
 
-                case INK_ALPHA: {
-                    uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                    uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelAlpha(color, *frameBuffer, alpha);
-                            }
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
-                }
+    if (width <= 0 || height <= 0)
+        return;
 
-                case INK_ADD: {
-                    uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelAdditive(color, *frameBuffer);
-                            }
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
-                }
+    GFXSurface *surface = &gfxSurface[sheetID];
+    validDraw           = true;
+    uint8 *lineBuffer   = &gfxLineBuffer[y];
+    uint16 *frameBuffer = &currentScreen->frameBuffer[x + currentScreen->pitch * y];
+    int32 srcX          = sprX;
+    int32 srcY          = sprY;
+    int32 lineStep      = 1;
 
-                case INK_SUB: {
-                    uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0) {
-                                uint16 color = activePalette[*pixels];
-                                setPixelSubtractive(color, *frameBuffer);
-                            }
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
-                }
+    switch (direction) {
+        default: return;
 
-                case INK_TINT:
-                    while (height--) {
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0)
-                                *frameBuffer = tintLookupTable[*frameBuffer];
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
+        case FLIP_NONE: break;
 
-                case INK_MASKED:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0 && *frameBuffer == maskColor)
-                                *frameBuffer = activePalette[*pixels];
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
+        case FLIP_X: srcX = widthFlip - 1 + sprX; break;
 
-                case INK_UNMASKED:
-                    while (height--) {
-                        uint16 *activePalette = fullPalette[*lineBuffer];
-                        lineBuffer++;
-                        int32 w = width;
-                        while (w--) {
-                            if (*pixels > 0 && *frameBuffer != maskColor)
-                                *frameBuffer = activePalette[*pixels];
-                            --pixels;
-                            ++frameBuffer;
-                        }
-                        frameBuffer += pitch;
-                        pixels -= gfxPitch;
-                    }
-                    break;
-            }
+        case FLIP_Y:
+            srcY     = sprY + heightFlip - 1;
+            lineStep = -1;
             break;
+
+        case FLIP_XY:
+            srcX     = widthFlip - 1 + sprX;
+            srcY     = sprY + heightFlip - 1;
+            lineStep = -1;
+            break;
+    }
+
+    if (inkEffect < INK_NONE || inkEffect > INK_UNMASKED)
+        return;
+
+    // the run table only covers the sheet itself, so anything reading outside of it falls back to the usual blitter
+    int32 colStart = direction & FLIP_X ? srcX - width + 1 : srcX;
+    int32 rowStart = lineStep < 0 ? srcY - height + 1 : srcY;
+    bool32 useRuns = surface->runTable && colStart >= 0 && colStart + width <= surface->width && rowStart >= 0 && rowStart + height <= surface->height;
+    uint8 *pixels  = &surface->pixels[srcX + surface->width * srcY];
+
+    if (drawRecording) {
+        DrawCommand *command = AddDrawCommand(useRuns ? DRAWCMD_SPRITERUNS : DRAWCMD_SPRITE, x, y, width, height, inkEffect, alpha);
+        command->flipX       = direction & FLIP_X;
+        command->sheetID     = sheetID;
+        command->pixels      = pixels;
+        command->srcX        = srcX;
+        command->srcY        = srcY;
+        command->lineStep    = useRuns ? lineStep : lineStep * surface->width;
+    }
+    else if (useRuns) {
+        spriteRunBlitters[inkEffect][direction & FLIP_X](frameBuffer, surface, srcX, srcY, lineBuffer, width, height, lineStep, alpha);
+    }
+    else {
+        spriteFlippedBlitters[inkEffect][direction & FLIP_X](frameBuffer, pixels, lineBuffer, width, height, lineStep * surface->width, alpha);
     }
 }
 void RSDK::DrawSpriteRotozoom(int32 x, int32 y, int32 pivotX, int32 pivotY, int32 width, int32 height, int32 sprX, int32 sprY, int32 scaleX,
@@ -3635,237 +3413,54 @@ void RSDK::DrawSpriteRotozoom(int32 x, int32 y, int32 pivotX, int32 pivotY, int3
     if (xSize >= 1 && ySize >= 1) {
         GFXSurface *surface = &gfxSurface[sheetID];
 
-        int32 fullX         = TO_FIXED(sprX + width);
-        int32 fullY         = TO_FIXED(sprY + height);
-        validDraw           = true;
-        int32 fullScaleX    = (int32)((512.0 / (float)scaleX) * 512.0);
-        int32 fullScaleY    = (int32)((512.0 / (float)scaleY) * 512.0);
-        int32 deltaXLen     = fullScaleX * sine >> 2;
-        int32 deltaX        = fullScaleX * cosine >> 2;
-        int32 pitch         = currentScreen->pitch - xSize;
-        int32 deltaYLen     = fullScaleY * cosine >> 2;
-        int32 deltaY        = fullScaleY * sine >> 2;
-        int32 lineSize      = surface->lineSize;
-        uint8 *lineBuffer   = &gfxLineBuffer[top];
-        int32 xLen          = left - x;
-        int32 yLen          = top - y;
-        uint8 *pixels       = surface->pixels;
-        uint16 *frameBuffer = &currentScreen->frameBuffer[left + (top * currentScreen->pitch)];
-        int32 fullSprX      = TO_FIXED(sprX) - 1;
-        int32 fullSprY      = TO_FIXED(sprY) - 1;
-
-        int32 drawX = 0, drawY = 0;
+        int32 fullScaleX = (int32)((512.0 / (float)scaleX) * 512.0);
+        int32 fullScaleY = (int32)((512.0 / (float)scaleY) * 512.0);
+        int32 xLen       = left - x;
+        int32 yLen       = top - y;
+        validDraw        = true;
+
+        SpriteRotozoom rotozoom;
+        rotozoom.deltaXLen = fullScaleX * sine >> 2;
+        rotozoom.deltaX    = fullScaleX * cosine >> 2;
+        rotozoom.deltaYLen = fullScaleY * cosine >> 2;
+        rotozoom.deltaY    = fullScaleY * sine >> 2;
+        rotozoom.fullSprX  = TO_FIXED(sprX) - 1;
+        rotozoom.fullSprY  = TO_FIXED(sprY) - 1;
+        rotozoom.fullX     = TO_FIXED(sprX + width);
+        rotozoom.fullY     = TO_FIXED(sprY + height);
+        rotozoom.drawX     = 0;
+        rotozoom.drawY     = 0;
+
         if (direction == FLIP_X) {
-            drawX     = sprXPos + deltaXLen * yLen - deltaX * xLen - (fullScaleX >> 1);
-            drawY     = sprYPos + deltaYLen * yLen + deltaY * xLen;
-            deltaX    = -deltaX;
-            deltaXLen = -deltaXLen;
+            rotozoom.drawX     = sprXPos + rotozoom.deltaXLen * yLen - rotozoom.deltaX * xLen - (fullScaleX >> 1);
+            rotozoom.drawY     = sprYPos + rotozoom.deltaYLen * yLen + rotozoom.deltaY * xLen;
+            rotozoom.deltaX    = -rotozoom.deltaX;
+            rotozoom.deltaXLen = -rotozoom.deltaXLen;
         }
         else if (!direction) {
-            drawX = sprXPos + deltaX * xLen - deltaXLen * yLen;
-            drawY = sprYPos + deltaYLen * yLen + deltaY * xLen;
+            rotozoom.drawX = sprXPos + rotozoom.deltaX * xLen - rotozoom.deltaXLen * yLen;
+            rotozoom.drawY = sprYPos + rotozoom.deltaYLen * yLen + rotozoom.deltaY * xLen;
         }
 
-        switch (inkEffect) {
-            case INK_NONE:
-                for (int32 y = 0; y < ySize; ++y) {
-                    uint16 *activePalette = fullPalette[*lineBuffer++];
-                    int32 drawXPos        = drawX;
-                    int32 drawYPos        = drawY;
-                    for (int32 x = 0; x < xSize; ++x) {
-                        if (drawXPos >= fullSprX && drawXPos < fullX && drawYPos >= fullSprY && drawYPos < fullY) {
-                            uint8 index = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
-                            if (index)
-                                *frameBuffer = activePalette[index];
-                        }
-
-                        ++frameBuffer;
-                        drawXPos += deltaX;
-                        drawYPos += deltaY;
-                    }
-
-                    drawX -= deltaXLen;
-                    drawY += deltaYLen;
-                    frameBuffer += pitch;
-                }
-                break;
-
-            case INK_BLEND:
-                for (int32 y = 0; y < ySize; ++y) {
-                    uint16 *activePalette = fullPalette[*lineBuffer++];
-                    int32 drawXPos        = drawX;
-                    int32 drawYPos        = drawY;
-                    for (int32 x = 0; x < xSize; ++x) {
-                        if (drawXPos >= fullSprX && drawXPos < fullX && drawYPos >= fullSprY && drawYPos < fullY) {
-                            uint8 index = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
-                            if (index)
-                                setPixelBlend(activePalette[index], *frameBuffer);
-                        }
-
-                        ++frameBuffer;
-                        drawXPos += deltaX;
-                        drawYPos += deltaY;
-                    }
-
-                    drawX -= deltaXLen;
-                    drawY += deltaYLen;
-                    frameBuffer += pitch;
-                }
-                break;
-
-            case INK_ALPHA: {
-                uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-                uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-                for (int32 y = 0; y < ySize; ++y) {
-                    uint16 *activePalette = fullPalette[*lineBuffer++];
-                    int32 drawXPos        = drawX;
-                    int32 drawYPos        = drawY;
-                    for (int32 x = 0; x < xSize; ++x) {
-                        if (drawXPos >= fullSprX && drawXPos < fullX && drawYPos >= fullSprY && drawYPos < fullY) {
-                            uint8 index = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
-                            if (index) {
-                                setPixelAlpha(activePalette[index], *frameBuffer, alpha);
-                            }
-                        }
-
-                        ++frameBuffer;
-                        drawXPos += deltaX;
-                        drawYPos += deltaY;
-                    }
-
-                    drawX -= deltaXLen;
-                    drawY += deltaYLen;
-                    frameBuffer += pitch;
-                }
-                break;
-            }
-
-            case INK_ADD: {
-                uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-                for (int32 y = 0; y < ySize; ++y) {
-                    uint16 *activePalette = fullPalette[*lineBuffer++];
-                    int32 drawXPos        = drawX;
-                    int32 drawYPos        = drawY;
-                    for (int32 x = 0; x < xSize; ++x) {
-                        if (drawXPos >= fullSprX && drawXPos < fullX && drawYPos >= fullSprY && drawYPos < fullY) {
-                            uint8 index = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
-                            if (index) {
-                                setPixelAdditive(activePalette[index], *frameBuffer);
-                            }
-                        }
-
-                        ++frameBuffer;
-                        drawXPos += deltaX;
-                        drawYPos += deltaY;
-                    }
-
-                    drawX -= deltaXLen;
-                    drawY += deltaYLen;
-                    frameBuffer += pitch;
-                }
-                break;
-            }
-
-            case INK_SUB: {
-                uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-                for (int32 y = 0; y < ySize; ++y) {
-                    uint16 *activePalette = fullPalette[*lineBuffer++];
-                    int32 drawXPos        = drawX;
-                    int32 drawYPos        = drawY;
-                    for (int32 x = 0; x < xSize; ++x) {
-                        if (drawXPos >= fullSprX && drawXPos < fullX && drawYPos >= fullSprY && drawYPos < fullY) {
-                            uint8 index = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
-                            if (index) {
-                                setPixelSubtractive(activePalette[index], *frameBuffer);
-                            }
-                        }
-
-                        ++frameBuffer;
-                        drawXPos += deltaX;
-                        drawYPos += deltaY;
-                    }
-
-                    drawX -= deltaXLen;
-                    drawY += deltaYLen;
-                    frameBuffer += pitch;
-                }
-                break;
-            }
-
-            case INK_TINT:
-                for (int32 y = 0; y < ySize; ++y) {
-                    int32 drawXPos = drawX;
-                    int32 drawYPos = drawY;
-                    for (int32 x = 0; x < xSize; ++x) {
-                        if (drawXPos >= fullSprX && drawXPos < fullX && drawYPos >= fullSprY && drawYPos < fullY) {
-                            uint8 index = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
-                            if (index)
-                                *frameBuffer = tintLookupTable[*frameBuffer];
-                        }
-
-                        ++frameBuffer;
-                        drawXPos += deltaX;
-                        drawYPos += deltaY;
-                    }
-
-                    drawX -= deltaXLen;
-                    drawY += deltaYLen;
-                    frameBuffer += pitch;
-                }
-                break;
-
-            case INK_MASKED:
-                for (int32 y = 0; y < ySize; ++y) {
-                    uint16 *activePalette = fullPalette[*lineBuffer++];
-                    int32 drawXPos        = drawX;
-                    int32 drawYPos        = drawY;
-                    for (int32 x = 0; x < xSize; ++x) {
-                        if (drawXPos >= fullSprX && drawXPos < fullX && drawYPos >= fullSprY && drawYPos < fullY) {
-                            uint8 index = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
-                            if (index && *frameBuffer == maskColor)
-                                *frameBuffer = activePalette[index];
-                        }
-
-                        ++frameBuffer;
-                        drawXPos += deltaX;
-                        drawYPos += deltaY;
-                    }
-
-                    drawX -= deltaXLen;
-                    drawY += deltaYLen;
-                    frameBuffer += pitch;
-                }
-                break;
-
-            case INK_UNMASKED:
-                for (int32 y = 0; y < ySize; ++y) {
-                    uint16 *activePalette = fullPalette[*lineBuffer++];
-                    int32 drawXPos        = drawX;
-                    int32 drawYPos        = drawY;
-                    for (int32 x = 0; x < xSize; ++x) {
-                        if (drawXPos >= fullSprX && drawXPos < fullX && drawYPos >= fullSprY && drawYPos < fullY) {
-                            uint8 index = pixels[(FROM_FIXED(drawYPos) << lineSize) + FROM_FIXED(drawXPos)];
-                            if (index && *frameBuffer != maskColor)
-                                *frameBuffer = activePalette[index];
-                        }
-
-                        ++frameBuffer;
-                        drawXPos += deltaX;
-                        drawYPos += deltaY;
-                    }
+        if (inkEffect < INK_NONE || inkEffect > INK_UNMASKED)
+            return;
 
-                    drawX -= deltaXLen;
-                    drawY += deltaYLen;
-                    frameBuffer += pitch;
-                }
-                break;
+        if (drawRecording) {
+            DrawCommand *command = AddDrawCommand(DRAWCMD_SPRITEROTOZOOM, left, top, xSize, ySize, inkEffect, alpha);
+            command->sheetID     = sheetID;
+            command->rotozoom    = rotozoom;
+        }
+        else {
+            uint16 *frameBuffer = &currentScreen->frameBuffer[left + (top * currentScreen->pitch)];
+            spriteRotozoomBlitters[inkEffect](frameBuffer, &gfxLineBuffer[top], surface, xSize, ySize, &rotozoom, alpha);
         }
     }
 }
 
 void RSDK::DrawDeformedSprite(uint16 sheetID, int32 inkEffect, int32 alpha)
 {
+    FlushPendingDraws();
+
     switch (inkEffect) {
         default: break;
         case INK_ALPHA:
@@ -3889,190 +3484,19 @@ void RSDK::DrawDeformedSprite(uint16 sheetID, int32 inkEffect, int32 alpha)
             break;
     }
 
-    validDraw              = true;
-    GFXSurface *surface    = &gfxSurface[sheetID];
-    uint8 *pixels          = surface->pixels;
-    int32 clipY1           = currentScreen->clipBound_Y1;
-    ScanlineInfo *scanline = &scanlines[clipY1];
-    uint16 *frameBuffer    = &currentScreen->frameBuffer[clipY1 * currentScreen->pitch];
-    uint8 *lineBuffer      = &gfxLineBuffer[clipY1];
-    int32 width            = surface->width - 1;
-    int32 height           = surface->height - 1;
-    int32 lineSize         = surface->lineSize;
-
-    switch (inkEffect) {
-        case INK_NONE:
-            for (; clipY1 < currentScreen->clipBound_Y2; ++clipY1) {
-                uint16 *activePalette = fullPalette[*lineBuffer++];
-                int32 lx              = scanline->position.x;
-                int32 ly              = scanline->position.y;
-                int32 dx              = scanline->deform.x;
-                int32 dy              = scanline->deform.y;
-                for (int32 i = 0; i < currentScreen->pitch; ++i) {
-                    uint8 palIndex = pixels[((FROM_FIXED(ly) & height) << lineSize) + (FROM_FIXED(lx) & width)];
-                    if (palIndex)
-                        *frameBuffer = activePalette[palIndex];
-
-                    lx += dx;
-                    ly += dy;
-                    ++frameBuffer;
-                }
-                ++scanline;
-            }
-            break;
-
-        case INK_BLEND:
-            for (; clipY1 < currentScreen->clipBound_Y2; ++clipY1) {
-                uint16 *activePalette = fullPalette[*lineBuffer++];
-                int32 lx              = scanline->position.x;
-                int32 ly              = scanline->position.y;
-                int32 dx              = scanline->deform.x;
-                int32 dy              = scanline->deform.y;
-                for (int32 i = 0; i < currentScreen->pitch; ++i) {
-                    uint8 palIndex = pixels[((FROM_FIXED(ly) & height) << lineSize) + (FROM_FIXED(lx) & width)];
-                    if (palIndex)
-                        setPixelBlend(activePalette[palIndex], *frameBuffer);
-
-                    lx += dx;
-                    ly += dy;
-                    ++frameBuffer;
-                }
-                ++scanline;
-            }
-            break;
-
-        case INK_ALPHA: {
-            uint16 *fbufferBlend = &blendLookupTable[0x20 * (0xFF - alpha)];
-            uint16 *pixelBlend   = &blendLookupTable[0x20 * alpha];
-
-            for (; clipY1 < currentScreen->clipBound_Y2; ++clipY1) {
-                uint16 *activePalette = fullPalette[*lineBuffer++];
-                int32 lx              = scanline->position.x;
-                int32 ly              = scanline->position.y;
-                int32 dx              = scanline->deform.x;
-                int32 dy              = scanline->deform.y;
-                for (int32 i = 0; i < currentScreen->pitch; ++i) {
-                    uint8 palIndex = pixels[((FROM_FIXED(ly) & height) << lineSize) + (FROM_FIXED(lx) & width)];
-                    if (palIndex) {
-                        setPixelAlpha(activePalette[palIndex], *frameBuffer, alpha);
-                    }
-
-                    lx += dx;
-                    ly += dy;
-                    ++frameBuffer;
-                }
-                ++scanline;
-            }
-            break;
-        }
-
-        case INK_ADD: {
-            uint16 *blendTablePtr = &blendLookupTable[0x20 * alpha];
-
-            for (; clipY1 < currentScreen->clipBound_Y2; ++clipY1) {
-                uint16 *activePalette = fullPalette[*lineBuffer++];
-                int32 lx              = scanline->position.x;
-                int32 ly              = scanline->position.y;
-                int32 dx              = scanline->deform.x;
-                int32 dy              = scanline->deform.y;
-                for (int32 i = 0; i < currentScreen->pitch; ++i) {
-                    uint8 palIndex = pixels[((FROM_FIXED(ly) & height) << lineSize) + (FROM_FIXED(lx) & width)];
-                    if (palIndex) {
-                        setPixelAdditive(activePalette[palIndex], *frameBuffer);
-                    }
-
-                    lx += dx;
-                    ly += dy;
-                    ++frameBuffer;
-                }
-                ++scanline;
-            }
-            break;
-        }
-
-        case INK_SUB: {
-            uint16 *subBlendTable = &subtractLookupTable[0x20 * alpha];
-
-            for (; clipY1 < currentScreen->clipBound_Y2; ++clipY1) {
-                uint16 *activePalette = fullPalette[*lineBuffer++];
-                int32 lx              = scanline->position.x;
-                int32 ly              = scanline->position.y;
-                int32 dx              = scanline->deform.x;
-                int32 dy              = scanline->deform.y;
-                for (int32 i = 0; i < currentScreen->pitch; ++i) {
-                    uint8 palIndex = pixels[((FROM_FIXED(ly) & height) << lineSize) + (FROM_FIXED(lx) & width)];
-                    if (palIndex) {
-                        setPixelSubtractive(activePalette[palIndex], *frameBuffer);
-                    }
-                    lx += dx;
-                    ly += dy;
-                    ++frameBuffer;
-                }
-                ++scanline;
-            }
-            break;
-        }
-
-        case INK_TINT:
-            for (; clipY1 < currentScreen->clipBound_Y2; ++clipY1) {
-                int32 lx = scanline->position.x;
-                int32 ly = scanline->position.y;
-                int32 dx = scanline->deform.x;
-                int32 dy = scanline->deform.y;
-                for (int32 i = 0; i < currentScreen->pitch; ++i) {
-                    uint8 palIndex = pixels[((FROM_FIXED(ly) & height) << lineSize) + (FROM_FIXED(lx) & width)];
-                    if (palIndex)
-                        *frameBuffer = tintLookupTable[*frameBuffer];
-                    lx += dx;
-                    ly += dy;
-                    ++frameBuffer;
-                }
-                ++scanline;
-            }
-            break;
-
-        case INK_MASKED:
-            for (; clipY1 < currentScreen->clipBound_Y2; ++clipY1) {
-                uint16 *activePalette = fullPalette[*lineBuffer++];
-                int32 lx              = scanline->position.x;
-                int32 ly              = scanline->position.y;
-                int32 dx              = scanline->deform.x;
-                int32 dy              = scanline->deform.y;
-                for (int32 i = 0; i < currentScreen->pitch; ++i) {
-                    uint8 palIndex = pixels[((FROM_FIXED(ly) & height) << lineSize) + (FROM_FIXED(lx) & width)];
-                    if (palIndex && *frameBuffer == maskColor)
-                        *frameBuffer = activePalette[palIndex];
-                    lx += dx;
-                    ly += dy;
-                    ++frameBuffer;
-                }
-                ++scanline;
-            }
-            break;
+    validDraw           = true;
+    int32 clipY1        = currentScreen->clipBound_Y1;
+    uint16 *frameBuffer = &currentScreen->frameBuffer[clipY1 * currentScreen->pitch];
 
-        case INK_UNMASKED:
-            for (; clipY1 < currentScreen->clipBound_Y2; ++clipY1) {
-                uint16 *activePalette = fullPalette[*lineBuffer++];
-                int32 lx              = scanline->position.x;
-                int32 ly              = scanline->position.y;
-                int32 dx              = scanline->deform.x;
-                int32 dy              = scanline->deform.y;
-                for (int32 i = 0; i < currentScreen->pitch; ++i) {
-                    uint8 palIndex = pixels[((FROM_FIXED(ly) & height) << lineSize) + (FROM_FIXED(lx) & width)];
-                    if (palIndex && *frameBuffer != maskColor)
-                        *frameBuffer = activePalette[palIndex];
-                    lx += dx;
-                    ly += dy;
-                    ++frameBuffer;
-                }
-                ++scanline;
-            }
-            break;
-    }
+    if (inkEffect >= INK_NONE && inkEffect <= INK_UNMASKED && clipY1 < currentScreen->clipBound_Y2)
+        spriteDeformedBlitters[inkEffect](frameBuffer, &gfxLineBuffer[clipY1], &gfxSurface[sheetID], &scanlines[clipY1], currentScreen->clipBound_Y2 - clipY1,
+                                          alpha);
 }
 
 void RSDK::DrawTile(uint16 *tiles, int32 countX, int32 countY, Vector2 *position, Vector2 *offset, bool32 screenRelative)
 {
+    FlushPendingDraws();
+
     if (tiles) {
         if (!position)
             position = &sceneInfo.entity->position;
@@ -4248,6 +3672,8 @@ void RSDK::DrawTile(uint16 *tiles, int32 countX, int32 countY, Vector2 *position
 }
 void RSDK::DrawAniTile(uint16 sheetID, uint16 tileIndex, uint16 srcX, uint16 srcY, uint16 width, uint16 height)
 {
+    FlushPendingDraws();
+
 
     if (sheetID < SURFACE_COUNT && tileIndex < TILE_COUNT) {
         GFXSurface *surface = &gfxSurface[sheetID];
@@ -4389,17 +3815,38 @@ void RSDK::DrawString(Animator *animator, Vector2 *position, String *string, int
         }
     }
 }
-void RSDK::DrawDevString(const char *string, int32 x, int32 y, int32 align, uint32 color)
+// Dev Text Cache
+DevTextEntry devTextCache[DEVTEXT_CACHE_SETS * DEVTEXT_CACHE_WAYS];
+char devTextChars[DEVTEXT_CHAR_COUNT];
+DevTextLine devTextLines[DEVTEXT_LINE_COUNT];
+DevTextSpan devTextSpans[DEVTEXT_SPAN_COUNT];
+uint32 devTextCharCount = 0;
+uint32 devTextLineCount = 0;
+uint32 devTextSpanCount = 0;
+uint32 devTextCacheTick = 0;
+
+void RSDK::ClearDevTextCache()
 {
-    uint16 color16 = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
+    memset(devTextCache, 0, sizeof(devTextCache));
+    devTextCharCount = 0;
+    devTextLineCount = 0;
+    devTextSpanCount = 0;
+}
+
+// splits the text into lines & rasterizes them into the span pool, returns false if the pool ran out of room part way through
+bool32 RasterizeDevText(DevTextEntry *entry, const char *string)
+{
+    entry->lineStart = devTextLineCount;
+    entry->lineCount = 0;
 
-    int32 charOffset   = 0;
+    // lines are split the same way they always have been, so an empty line still ends the string
+    uint32 charOffset  = 0;
     bool32 linesRemain = true;
     while (linesRemain) {
         linesRemain = false;
 
-        int32 lineSize = 0;
-        char cur       = string[charOffset];
+        uint32 lineSize = 0;
+        char cur        = string[charOffset];
         if (cur != '\n') {
             while (cur) {
                 cur = string[++charOffset];
@@ -4411,46 +3858,149 @@ void RSDK::DrawDevString(const char *string, int32 x, int32 y, int32 align, uint
             }
         }
 
-        if (y >= 0 && y < currentScreen->size.y - 7) {
-            int32 offset = 0;
-            switch (align) {
-                default:
-                case ALIGN_LEFT: offset = 0; break;
+        if (devTextLineCount >= DEVTEXT_LINE_COUNT)
+            return false;
 
-                case ALIGN_CENTER: offset = 4 * lineSize; break;
+        DevTextLine *line = &devTextLines[devTextLineCount++];
+        line->spanStart   = devTextSpanCount;
+        line->spanCount   = 0;
+        line->length      = lineSize;
+        entry->lineCount++;
 
-                case ALIGN_RIGHT: offset = 8 * lineSize; break;
-            }
-            int32 drawX = x - offset;
-
-            const char *curChar = &string[charOffset++ - lineSize];
+        const char *lineChars = &string[charOffset++ - lineSize];
 
-            for (int32 c = 0; c < lineSize; ++c) {
-                if (drawX >= 0 && drawX < currentScreen->size.x - 7) {
-                    uint16 *frameBuffer = &currentScreen->frameBuffer[drawX + y * currentScreen->pitch];
+        // lines have to start on screen to be drawn at all, so nothing past the widest screen can ever show up
+        uint32 glyphCount = MIN(lineSize, SCREEN_XMAX / 8);
+        for (int32 h = 0; h < 8; ++h) {
+            DevTextSpan *span = NULL;
 
-                    if ((*curChar < '\t' || *curChar > '\n') && *curChar != ' ') {
-                        uint8 *textStencilPtr = &devTextStencil[0x40 * *curChar];
+            for (uint32 c = 0; c < glyphCount; ++c) {
+                uint8 glyph = lineChars[c];
+                if ((glyph >= '\t' && glyph <= '\n') || glyph == ' ' || glyph >= 0x80)
+                    continue;
 
-                        for (int32 h = 0; h < 8; ++h) {
-                            for (int32 w = 0; w < 8; ++w) {
-                                if (*textStencilPtr)
-                                    *frameBuffer = color16;
-
-                                ++textStencilPtr;
-                                ++frameBuffer;
-                            }
+                uint8 *textStencilPtr = &devTextStencil[0x40 * glyph + 8 * h];
+                for (int32 w = 0; w < 8; ++w) {
+                    if (!textStencilPtr[w])
+                        continue;
 
-                            frameBuffer += currentScreen->pitch - 8;
-                        }
+                    uint16 px = (c << 3) + w;
+                    if (span && span->x + span->length == px && span->length < 0xFF) {
+                        span->length++;
                     }
+                    else {
+                        if (devTextSpanCount >= DEVTEXT_SPAN_COUNT)
+                            return false;
 
-                    ++curChar;
-                    drawX += 8;
+                        span         = &devTextSpans[devTextSpanCount++];
+                        span->x      = px;
+                        span->row    = h;
+                        span->length = 1;
+                        line->spanCount++;
+                    }
                 }
             }
         }
+    }
+
+    return true;
+}
+
+DevTextEntry *GetDevTextEntry(const char *string)
+{
+    uint32 hash   = 0x811C9DC5;
+    uint32 length = 0;
+    for (; string[length]; ++length) hash = (hash ^ (uint8)string[length]) * 0x01000193;
+
+    // anything too long to keep a copy of gets cut off, that's way more than could ever fit on screen anyways
+    length = MIN(length, DEVTEXT_CHAR_COUNT - 1);
+
+    DevTextEntry *set  = &devTextCache[(hash & (DEVTEXT_CACHE_SETS - 1)) * DEVTEXT_CACHE_WAYS];
+    DevTextEntry *slot = set;
+    for (int32 w = 0; w < DEVTEXT_CACHE_WAYS; ++w) {
+        DevTextEntry *entry = &set[w];
+        if (entry->lastUsed && entry->hash == hash && entry->textLength == length
+            && !memcmp(&devTextChars[entry->textStart], string, length)) {
+            entry->lastUsed = ++devTextCacheTick;
+            return entry;
+        }
+
+        if (entry->lastUsed < slot->lastUsed)
+            slot = entry;
+    }
+
+    // the pools are only ever appended to, so when they're full everything gets thrown out & this string starts over in an empty cache
+    // if it still doesn't fit it's kept with as many lines as there was room for
+    if (devTextCharCount + length + 1 > DEVTEXT_CHAR_COUNT)
+        ClearDevTextCache();
+
+    slot->hash       = hash;
+    slot->textStart  = devTextCharCount;
+    slot->textLength = length;
+    slot->lastUsed   = ++devTextCacheTick;
+    memcpy(&devTextChars[devTextCharCount], string, length);
+    devTextChars[devTextCharCount + length] = 0;
+    devTextCharCount += length + 1;
+
+    if (!RasterizeDevText(slot, &devTextChars[slot->textStart])) {
+        ClearDevTextCache();
+
+        slot->hash       = hash;
+        slot->textStart  = 0;
+        slot->textLength = length;
+        slot->lastUsed   = ++devTextCacheTick;
+        memcpy(devTextChars, string, length);
+        devTextChars[length] = 0;
+        devTextCharCount     = length + 1;
+
+        RasterizeDevText(slot, devTextChars);
+    }
+
+    return slot;
+}
+
+void RSDK::DrawDevString(const char *string, int32 x, int32 y, int32 align, uint32 color)
+{
+    FlushPendingDraws();
+
+    uint16 color16 = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
+
+    DevTextEntry *entry = GetDevTextEntry(string);
+    for (uint32 l = 0; l < entry->lineCount; ++l, y += 8) {
+        DevTextLine *line = &devTextLines[entry->lineStart + l];
+
+        // a line that's off screen has always ended the string, since the newline after it never got skipped over
+        if (y < 0 || y >= currentScreen->size.y - 7)
+            break;
+
+        int32 offset = 0;
+        switch (align) {
+            default:
+            case ALIGN_LEFT: offset = 0; break;
+
+            case ALIGN_CENTER: offset = 4 * line->length; break;
+
+            case ALIGN_RIGHT: offset = 8 * line->length; break;
+        }
+        int32 drawX = x - offset;
 
-        y += 8;
+        // glyphs are only drawn while they fit on screen entirely & the first one that doesn't ends the line
+        if (drawX < 0)
+            continue;
+
+        int32 drawWidth = 8 * MIN((int32)line->length, (currentScreen->size.x - drawX) / 8);
+        if (drawWidth <= 0)
+            continue;
+
+        uint16 *frameBuffer = &currentScreen->frameBuffer[drawX + y * currentScreen->pitch];
+        DevTextSpan *span   = &devTextSpans[line->spanStart];
+        for (uint32 s = 0; s < line->spanCount; ++s, ++span) {
+            if (span->x >= drawWidth)
+                continue;
+
+            int32 length           = MIN(span->length, drawWidth - span->x);
+            uint16 *frameBufferPtr = &frameBuffer[span->x + span->row * currentScreen->pitch];
+            while (length--) *frameBufferPtr++ = color16;
+        }
     }
 }
@@ -71,6 +71,10 @@ struct GFXSurface {
     int32 width;
     int32 lineSize;
     uint8 scope;
+    // optional transparent-run table, built by BuildSurfaceRuns
+    // the first height entries are each line's offset into the run data that follows them (in uint16s)
+    // each line's runs are a count, then that many (skip, length) pairs of transparent/opaque pixels
+    uint32 *runTable;
 };
 
 struct ScreenInfo {
@@ -289,6 +293,32 @@ void GenerateBlendLookupTable();
 
 void InitSystemSurfaces();
 
+#define FRAMEBUFFER_BAND_SIZE  (16)
+#define FRAMEBUFFER_BAND_COUNT (SCREEN_YSIZE / FRAMEBUFFER_BAND_SIZE)
+
+// returns a mask of the 16-row bands of a screen that changed since they were last handed to CopyFrameBuffer
+// so the render devices only have to upload the parts of the screen that actually changed
+uint32 GetFrameBufferUploadBands(int32 screenID);
+// makes the next upload copy everything, needs to be called whenever the screen textures get (re)created
+void ResetFrameBufferBands();
+
+// steps through each run of changed bands, use as "for (int32 y = 0, h = 0; GetNextFrameBufferUpload(bands, &y, &h); y += h)"
+inline bool32 GetNextFrameBufferUpload(uint32 bands, int32 *y, int32 *height)
+{
+    int32 band = *y / FRAMEBUFFER_BAND_SIZE;
+    while (band < FRAMEBUFFER_BAND_COUNT && !(bands & (1 << band))) ++band;
+
+    if (band >= FRAMEBUFFER_BAND_COUNT)
+        return false;
+
+    int32 end = band;
+    while (end < FRAMEBUFFER_BAND_COUNT && (bands & (1 << end))) ++end;
+
+    *y      = band * FRAMEBUFFER_BAND_SIZE;
+    *height = (end - band) * FRAMEBUFFER_BAND_SIZE;
+    return true;
+}
+
 void GetDisplayInfo(int32 *displayID, int32 *width, int32 *height, int32 *refreshRate, char *text);
 void GetWindowSize(int32 *width, int32 *height);
 
@@ -382,6 +412,122 @@ void DrawCircleOutline(int32 x, int32 y, int32 innerRadius, int32 outerRadius, u
 void DrawFace(Vector2 *vertices, int32 vertCount, int32 r, int32 g, int32 b, int32 alpha, int32 inkEffect);
 void DrawBlendedFace(Vector2 *vertices, uint32 *colors, int32 vertCount, int32 alpha, int32 inkEffect);
 
+// tile-binned version of DrawFace, faces are queued up in the order they'd be drawn & then filled a screen tile at a time
+// returns false if nothing would be drawn with the given ink/alpha (any faces added are just ignored in that case)
+bool32 BeginFaceBatch(int32 alpha, int32 inkEffect);
+void AddFaceToBatch(Vector2 *vertices, int32 vertCount, int32 r, int32 g, int32 b);
+void DrawFaceBatch();
+
+// mode-7 style affine tile sampling, shared by rotozoom layers & the legacy 3D floor/sky layers
+struct Mode7Tile {
+    // pixel (0, 0) of the tile as it should be sampled (flips are handled through the strides), NULL draws nothing
+    const uint8 *pixels;
+    int32 strideX;
+    int32 strideY;
+};
+
+// steps posX/posY across a scanline & writes the palette index of each pixel into indices
+// pixelShift is how many fractional bits the positions have, fetchTile(tx, ty) is only called when the sampled 16x16 tile changes
+template <typename TileFetcher>
+inline void SampleMode7Line(uint8 *indices, int32 count, int32 posX, int32 posY, int32 stepX, int32 stepY, int32 pixelShift, TileFetcher fetchTile)
+{
+    int32 tileShift = pixelShift + 4;
+    int32 lastTX    = posX >> tileShift;
+    int32 lastTY    = posY >> tileShift;
+    Mode7Tile tile  = fetchTile(lastTX, lastTY);
+
+    for (int32 i = 0; i < count; ++i) {
+        int32 tx = posX >> tileShift;
+        int32 ty = posY >> tileShift;
+        if (tx != lastTX || ty != lastTY) {
+            lastTX = tx;
+            lastTY = ty;
+            tile   = fetchTile(tx, ty);
+        }
+
+        if (tile.pixels)
+            indices[i] = tile.pixels[((posX >> pixelShift) & 0xF) * tile.strideX + ((posY >> pixelShift) & 0xF) * tile.strideY];
+        else
+            indices[i] = 0;
+
+        posX += stepX;
+        posY += stepY;
+    }
+}
+
+// resolves a line of palette indices into the framebuffer, index 0 is transparent
+void DrawIndexedLine(uint16 *frameBuffer, const uint8 *indices, int32 count, const uint16 *palette);
+
+// ink kernels, these composite a whole span of src onto dst with the given ink (SIMD where it's available)
+// any pixel with a 0 in mask is skipped, mask can be NULL to draw every pixel
+void InkBlendSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count);
+void InkAlphaSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count, int32 alpha);
+void InkAddSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count, int32 alpha);
+void InkSubSpan(uint16 *dst, const uint16 *src, const uint8 *mask, int32 count, int32 alpha);
+// FillScreen's per-channel fade towards a colour, the clrBlend values are the colour's 5-bit channels already scaled by alpha
+void InkFadeSpan(uint16 *dst, int32 count, int32 alphaR, int32 alphaG, int32 alphaB, uint16 clrBlendR, uint16 clrBlendG, uint16 clrBlendB);
+
+// where a rotozoomed sprite starts sampling from & how it steps through the sheet, all in 16.16 fixed point
+struct SpriteRotozoom {
+    int32 drawX;
+    int32 drawY;
+    int32 deltaX;
+    int32 deltaY;
+    int32 deltaXLen;
+    int32 deltaYLen;
+    int32 fullSprX;
+    int32 fullSprY;
+    int32 fullX;
+    int32 fullY;
+};
+
+// Draw Commands
+// when drawRecording is set (engine.deferredDrawing, during ProcessObjectDrawLists) sprites & rectangles are recorded instead of being drawn
+// straight away, then FlushDrawCommands rasterizes them all at once, split into bands of the screen across the thread pool
+// anything that's still drawn immediately (or changes the palette) flushes first, so everything still lands in the same order
+#define DRAWCOMMAND_COUNT (0x800)
+
+enum DrawCommandTypes {
+    DRAWCMD_SPRITE,
+    DRAWCMD_SPRITERUNS,
+    DRAWCMD_SPRITEROTOZOOM,
+    DRAWCMD_RECTANGLE,
+};
+
+// everything here is already clipped & resolved, so a command can be drawn without looking at any draw state other than the palette
+struct DrawCommand {
+    uint8 type;
+    uint8 inkEffect;
+    uint8 flipX;
+    uint16 sheetID;
+    uint16 color;
+    int32 alpha;
+    // the area of the screen it covers
+    int32 left;
+    int32 top;
+    int32 width;
+    int32 height;
+    // DRAWCMD_SPRITE
+    uint8 *pixels;
+    // DRAWCMD_SPRITERUNS, lineStep is also used by DRAWCMD_SPRITE
+    int32 srcX;
+    int32 srcY;
+    int32 lineStep;
+    // DRAWCMD_SPRITEROTOZOOM
+    SpriteRotozoom rotozoom;
+};
+
+extern bool32 drawRecording;
+extern int32 drawCommandCount;
+
+DrawCommand *AddDrawCommand(uint8 type, int32 left, int32 top, int32 width, int32 height, int32 inkEffect, int32 alpha);
+void FlushDrawCommands(); // FlushPendingDraws (Palette.hpp) is the cheap version that only calls this if anything was recorded
+
+// builds (or rebuilds) a sheet's run table, sheets that don't have a table are drawn the slower way
+void BuildSurfaceRuns(GFXSurface *surface);
+// call this after changing a sheet's pixels at runtime, otherwise the old runs would still be used to draw it
+void ClearSurfaceRuns(GFXSurface *surface);
+
 void DrawSprite(Animator *animator, Vector2 *position, bool32 screenRelative);
 void DrawSpriteFlipped(int32 x, int32 y, int32 width, int32 height, int32 sprX, int32 sprY, int32 direction, int32 inkEffect, int32 alpha,
                        int32 sheetID);
@@ -403,6 +549,41 @@ inline void DrawDynamicAniTile(Animator *animator, uint16 tileIndex)
 }
 #endif
 
+// Dev Text Cache
+// DrawDevString keeps the strings it draws pre-rasterized as runs of lit pixels, keyed on their text
+// the color & alignment are only applied when drawing, so the same text shares one entry no matter where or how it's drawn
+// a string whose text changes just misses & gets rasterized again, the stale entry ages out of its set
+#define DEVTEXT_CACHE_SETS (0x80)
+#define DEVTEXT_CACHE_WAYS (4)
+#define DEVTEXT_CHAR_COUNT (0x8000)
+#define DEVTEXT_LINE_COUNT (0x2000)
+#define DEVTEXT_SPAN_COUNT (0x20000)
+
+// a run of lit pixels in one row of a line, runs are merged across neighbouring glyphs
+struct DevTextSpan {
+    uint16 x;
+    uint8 row;
+    uint8 length;
+};
+
+struct DevTextLine {
+    uint32 spanStart;
+    uint32 spanCount;
+    uint32 length; // in chars, used for alignment & clipping
+};
+
+struct DevTextEntry {
+    uint32 hash;
+    uint32 textStart;
+    uint32 textLength;
+    uint32 lineStart;
+    uint32 lineCount;
+    uint32 lastUsed; // 0 if the entry is empty
+};
+
+// throws out every cached string, this happens by itself when the cache runs out of room
+void ClearDevTextCache();
+
 void DrawString(Animator *animator, Vector2 *position, String *string, int32 endFrame, int32 textLength, int32 align, int32 spacing, void *unused,
                 Vector2 *charPositions, bool32 screenRelative);
 void DrawDevString(const char *string, int32 x, int32 y, int32 align, uint32 color);
@@ -301,6 +301,7 @@ bool RenderDevice::InitGraphicsAPI()
 
     glActiveTexture(GL_TEXTURE0);
     glGenTextures(SCREEN_COUNT, screenTextures);
+    ResetFrameBufferBands();
 
     for (int32 i = 0; i < SCREEN_COUNT; ++i) {
         glBindTexture(GL_TEXTURE_2D, screenTextures[i]);
@@ -501,8 +502,15 @@ void RenderDevice::UpdateFPSCap() { lastFrame = glfwGetTime(); }
 void RenderDevice::CopyFrameBuffer()
 {
     for (int32 s = 0; s < videoSettings.screenCount; ++s) {
+        uint32 bands = GetFrameBufferUploadBands(s);
+        if (!bands)
+            continue;
+
         glBindTexture(GL_TEXTURE_2D, screenTextures[s]);
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, screens[s].pitch, SCREEN_YSIZE, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, screens[s].frameBuffer);
+        for (int32 y = 0, h = 0; GetNextFrameBufferUpload(bands, &y, &h); y += h) {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, screens[s].pitch, h, GL_RGB, GL_UNSIGNED_SHORT_5_6_5,
+                            &screens[s].frameBuffer[y * screens[s].pitch]);
+        }
     }
 }
 
@@ -1214,14 +1214,33 @@ void RSDK::Legacy::DrawVLineScrollLayer(int32 layerID)
         frameBuffer -= GFX_FBUFFERMINUSONE;
     }
 }
+// 3D floor/sky layers sample 16x16 tiles out of the 128x128 chunk layout that's been unpacked into tile3DFloorBuffer
+inline Mode7Tile Fetch3DFloorTile(int32 tx, int32 ty, int32 tileCountX, int32 tileCountY)
+{
+    using namespace RSDK::Legacy;
+
+    if (tx < 0 || tx >= tileCountX || ty < 0 || ty >= tileCountY)
+        return Mode7Tile{ NULL, 0, 0 };
+
+    int32 chunk         = tile3DFloorBuffer[(ty << 8) + tx];
+    const uint8 *pixels = &tilesetGFXData[tiles128x128.gfxDataPos[chunk]];
+    switch (tiles128x128.direction[chunk]) {
+        case FLIP_NONE: return Mode7Tile{ pixels, 1, TILE_SIZE };
+        case FLIP_X: return Mode7Tile{ pixels + 0xF, -1, TILE_SIZE };
+        case FLIP_Y: return Mode7Tile{ pixels + SCREEN_YSIZE, 1, -TILE_SIZE };
+        case FLIP_XY: return Mode7Tile{ pixels + 0xF + SCREEN_YSIZE, -1, -TILE_SIZE };
+        default: return Mode7Tile{ pixels, 0, 0 };
+    }
+}
+
 void RSDK::Legacy::Draw3DFloorLayer(int32 layerID)
 {
     TileLayer *layer = &stageLayouts[activeTileLayers[layerID]];
     if (!layer->xsize || !layer->ysize)
         return;
 
-    int32 layerWidth    = layer->xsize << 7;
-    int32 layerHeight   = layer->ysize << 7;
+    int32 tileCountX    = layer->xsize << 3;
+    int32 tileCountY    = layer->ysize << 3;
     int32 layerYPos     = layer->ypos;
     int32 layerZPos     = layer->zpos;
     int32 sinValue      = sinM7LookupTable[layer->angle];
@@ -1231,39 +1250,22 @@ void RSDK::Legacy::Draw3DFloorLayer(int32 layerID)
     int32 layerXPos     = layer->xpos >> 4;
     int32 ZBuffer       = layerZPos >> 4;
 
+    auto fetchTile = [tileCountX, tileCountY](int32 tx, int32 ty) { return Fetch3DFloorTile(tx, ty, tileCountX, tileCountY); };
+
+    uint8 indices[SCREEN_XMAX];
     for (int32 i = 4; i < 112; ++i) {
         if (!(i & 1)) {
             activePalette = fullPalette[*lineBuffer];
             lineBuffer++;
         }
-        int32 XBuffer    = layerYPos / (i << 9) * -cosValue >> 8;
-        int32 YBuffer    = sinValue * (layerYPos / (i << 9)) >> 8;
-        int32 XPos       = layerXPos + (3 * sinValue * (layerYPos / (i << 9)) >> 2) - XBuffer * SCREEN_CENTERX;
-        int32 YPos       = ZBuffer + (3 * cosValue * (layerYPos / (i << 9)) >> 2) - YBuffer * SCREEN_CENTERX;
-        int32 lineBuffer = 0;
-        while (lineBuffer < GFX_LINESIZE) {
-            int32 tileX = XPos >> 12;
-            int32 tileY = YPos >> 12;
-            if (tileX > -1 && tileX < layerWidth && tileY > -1 && tileY < layerHeight) {
-                int32 chunk   = tile3DFloorBuffer[(YPos >> 16 << 8) + (XPos >> 16)];
-                uint8 *pixels = &tilesetGFXData[tiles128x128.gfxDataPos[chunk]];
-                switch (tiles128x128.direction[chunk]) {
-                    case FLIP_NONE: pixels += TILE_SIZE * (tileY & 0xF) + (tileX & 0xF); break;
-                    case FLIP_X: pixels += TILE_SIZE * (tileY & 0xF) + 15 - (tileX & 0xF); break;
-                    case FLIP_Y: pixels += (tileX & 0xF) + SCREEN_YSIZE - TILE_SIZE * (tileY & 0xF); break;
-                    case FLIP_XY: pixels += 15 - (tileX & 0xF) + SCREEN_YSIZE - TILE_SIZE * (tileY & 0xF); break;
-                    default: break;
-                }
-
-                if (*pixels > 0)
-                    *frameBuffer = activePalette[*pixels];
-            }
-            ++frameBuffer;
-            ++lineBuffer;
+        int32 XBuffer = layerYPos / (i << 9) * -cosValue >> 8;
+        int32 YBuffer = sinValue * (layerYPos / (i << 9)) >> 8;
+        int32 XPos    = layerXPos + (3 * sinValue * (layerYPos / (i << 9)) >> 2) - XBuffer * SCREEN_CENTERX;
+        int32 YPos    = ZBuffer + (3 * cosValue * (layerYPos / (i << 9)) >> 2) - YBuffer * SCREEN_CENTERX;
 
-            XPos += XBuffer;
-            YPos += YBuffer;
-        }
+        SampleMode7Line(indices, GFX_LINESIZE, XPos, YPos, XBuffer, YBuffer, 12, fetchTile);
+        DrawIndexedLine(frameBuffer, indices, GFX_LINESIZE, activePalette);
+        frameBuffer += GFX_LINESIZE;
     }
 }
 void RSDK::Legacy::Draw3DSkyLayer(int32 layerID)
@@ -1272,8 +1274,8 @@ void RSDK::Legacy::Draw3DSkyLayer(int32 layerID)
     if (!layer->xsize || !layer->ysize)
         return;
 
-    int32 layerWidth    = layer->xsize << 7;
-    int32 layerHeight   = layer->ysize << 7;
+    int32 tileCountX    = layer->xsize << 3;
+    int32 tileCountY    = layer->ysize << 3;
     int32 layerYPos     = layer->ypos;
     int32 sinValue      = sinM7LookupTable[layer->angle & 0x1FF];
     int32 cosValue      = cosM7LookupTable[layer->angle & 0x1FF];
@@ -1281,47 +1283,37 @@ void RSDK::Legacy::Draw3DSkyLayer(int32 layerID)
     uint8 *lineBuffer   = &gfxLineBuffer[((SCREEN_YSIZE / 2) + 12)];
     int32 layerXPos     = layer->xpos >> 4;
     int32 layerZPos     = layer->zpos >> 4;
+
+    auto fetchTile = [tileCountX, tileCountY](int32 tx, int32 ty) { return Fetch3DFloorTile(tx, ty, tileCountX, tileCountY); };
+
+    // the sky is sampled at twice the screen res, each screen pixel ends up as the last opaque sample out of its 2x2 block
+    uint8 indices[SCREEN_XMAX * 2];
+    uint8 lineIndices[SCREEN_XMAX];
     for (int32 i = TILE_SIZE / 2; i < SCREEN_YSIZE - TILE_SIZE; ++i) {
         if (!(i & 1)) {
             activePalette = fullPalette[*lineBuffer];
             lineBuffer++;
         }
 
-        int32 xBuffer    = layerYPos / (i << 8) * -cosValue >> 9;
-        int32 yBuffer    = sinValue * (layerYPos / (i << 8)) >> 9;
-        int32 XPos       = layerXPos + (3 * sinValue * (layerYPos / (i << 8)) >> 2) - xBuffer * GFX_LINESIZE;
-        int32 YPos       = layerZPos + (3 * cosValue * (layerYPos / (i << 8)) >> 2) - yBuffer * GFX_LINESIZE;
-        int32 lineBuffer = 0;
+        int32 xBuffer = layerYPos / (i << 8) * -cosValue >> 9;
+        int32 yBuffer = sinValue * (layerYPos / (i << 8)) >> 9;
+        int32 XPos    = layerXPos + (3 * sinValue * (layerYPos / (i << 8)) >> 2) - xBuffer * GFX_LINESIZE;
+        int32 YPos    = layerZPos + (3 * cosValue * (layerYPos / (i << 8)) >> 2) - yBuffer * GFX_LINESIZE;
 
-        while (lineBuffer < GFX_LINESIZE * 2) {
-            int32 tileX = XPos >> 12;
-            int32 tileY = YPos >> 12;
-            if (tileX > -1 && tileX < layerWidth && tileY > -1 && tileY < layerHeight) {
-                int32 chunk   = tile3DFloorBuffer[(YPos >> 16 << 8) + (XPos >> 16)];
-                uint8 *pixels = &tilesetGFXData[tiles128x128.gfxDataPos[chunk]];
-
-                switch (tiles128x128.direction[chunk]) {
-                    case FLIP_NONE: pixels += TILE_SIZE * (tileY & 0xF) + (tileX & 0xF); break;
-                    case FLIP_X: pixels += TILE_SIZE * (tileY & 0xF) + 0xF - (tileX & 0xF); break;
-                    case FLIP_Y: pixels += (tileX & 0xF) + SCREEN_YSIZE - TILE_SIZE * (tileY & 0xF); break;
-                    case FLIP_XY: pixels += 0xF - (tileX & 0xF) + SCREEN_YSIZE - TILE_SIZE * (tileY & 0xF); break;
-                    default: break;
-                }
+        SampleMode7Line(indices, GFX_LINESIZE * 2, XPos, YPos, xBuffer, yBuffer, 12, fetchTile);
 
-                if (*pixels > 0)
-                    *frameBuffer = activePalette[*pixels];
-            }
-
-            if (lineBuffer & 1)
-                ++frameBuffer;
-
-            lineBuffer++;
-            XPos += xBuffer;
-            YPos += yBuffer;
+        uint8 *samples = indices;
+        for (int32 x = 0; x < GFX_LINESIZE; ++x) {
+            uint8 index = samples[1] ? samples[1] : samples[0];
+            if (!(i & 1) || index)
+                lineIndices[x] = index;
+            samples += 2;
         }
 
-        if (!(i & 1))
-            frameBuffer -= GFX_LINESIZE;
+        if (i & 1) {
+            DrawIndexedLine(frameBuffer, lineIndices, GFX_LINESIZE, activePalette);
+            frameBuffer += GFX_LINESIZE;
+        }
     }
 }
 
@@ -299,18 +299,8 @@ void RSDK::Legacy::v4::Sort3DDrawList()
         drawList3D[i].faceID = i;
     }
 
-    for (int32 i = 0; i < faceCount; ++i) {
-        for (int32 j = faceCount - 1; j > i; --j) {
-            if (drawList3D[j].depth > drawList3D[j - 1].depth) {
-                int32 faceID             = drawList3D[j].faceID;
-                int32 depth              = drawList3D[j].depth;
-                drawList3D[j].faceID     = drawList3D[j - 1].faceID;
-                drawList3D[j].depth      = drawList3D[j - 1].depth;
-                drawList3D[j - 1].faceID = faceID;
-                drawList3D[j - 1].depth  = depth;
-            }
-        }
-    }
+    static DrawListEntry3D sortBuffer[LEGACY_v4_FACEBUFFER_SIZE];
+    SortFacesByDepth(drawList3D, sortBuffer, faceCount);
 }
 void RSDK::Legacy::v4::Draw3DScene(int32 spriteSheetID)
 {
@@ -35,6 +35,8 @@ void RSDK::LoadPalette(uint8 bankID, const char *filename, uint16 disabledRows)
     FileInfo info;
     InitFileInfo(&info);
     if (LoadFile(&info, fullFilePath, FMODE_RB)) {
+        FlushPendingDraws();
+
         for (int32 r = 0; r < 0x10; ++r) {
             if (!(disabledRows >> r & 1)) {
                 for (int32 c = 0; c < 0x10; ++c) {
@@ -58,6 +60,8 @@ void RSDK::BlendColors(uint8 destBankID, uint32 *srcColorsA, uint32 *srcColorsB,
     if (destBankID >= PALETTE_BANK_COUNT || !srcColorsA || !srcColorsB)
         return;
 
+    FlushPendingDraws();
+
     blendAmount = CLAMP(blendAmount, 0x00, 0xFF);
 
     uint8 blendA         = 0xFF - blendAmount;
@@ -81,6 +85,8 @@ void RSDK::SetPaletteFade(uint8 destBankID, uint8 srcBankA, uint8 srcBankB, int1
     if (destBankID >= PALETTE_BANK_COUNT || srcBankA >= PALETTE_BANK_COUNT || srcBankB >= PALETTE_BANK_COUNT)
         return;
 
+    FlushPendingDraws();
+
     blendAmount = CLAMP(blendAmount, 0x00, 0xFF);
     endIndex    = MIN(endIndex, 0x100);
 
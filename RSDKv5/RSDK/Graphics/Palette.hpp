@@ -41,8 +41,18 @@ extern uint16 tintLookupTable[0x10000];
 void LoadPalette(uint8 bankID, const char *filePath, uint16 disabledRows);
 #endif
 
+// recorded draws read the palette when they're flushed, so they need to go out before it changes (see Drawing.hpp)
+extern int32 drawCommandCount;
+void FlushDrawCommands();
+inline void FlushPendingDraws()
+{
+    if (drawCommandCount)
+        FlushDrawCommands();
+}
+
 inline void SetActivePalette(uint8 newActiveBank, int32 startLine, int32 endLine)
 {
+    FlushPendingDraws();
     if (newActiveBank < PALETTE_BANK_COUNT)
         for (int32 l = startLine; l < endLine && l < SCREEN_YSIZE; l++) gfxLineBuffer[l] = newActiveBank;
 }
@@ -62,16 +72,22 @@ inline uint32 GetPaletteEntry(uint8 bankID, uint8 index)
 
 inline void SetPaletteEntry(uint8 bankID, uint8 index, uint32 color)
 {
+    FlushPendingDraws();
     fullPalette[bankID][index] = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
 }
 
 inline void SetPaletteMask(uint32 color)
 {
+    FlushPendingDraws();
     maskColor = rgb32To16_B[(color >> 0) & 0xFF] | rgb32To16_G[(color >> 8) & 0xFF] | rgb32To16_R[(color >> 16) & 0xFF];
 }
 
 #if RETRO_REV02
-inline void SetTintLookupTable(uint16 *lookupTable) { tintLookupTable = lookupTable; }
+inline void SetTintLookupTable(uint16 *lookupTable)
+{
+    FlushPendingDraws();
+    tintLookupTable = lookupTable;
+}
 
 #if RETRO_USE_MOD_LOADER && RETRO_MOD_LOADER_VER >= 2
 inline uint16 *GetTintLookupTable() { return tintLookupTable; }
@@ -83,6 +99,7 @@ inline uint16 *GetTintLookupTable() { return tintLookupTable; }
 
 inline void CopyPalette(uint8 sourceBank, uint8 srcBankStart, uint8 destinationBank, uint8 destBankStart, uint16 count)
 {
+    FlushPendingDraws();
     if (sourceBank < PALETTE_BANK_COUNT && destinationBank < PALETTE_BANK_COUNT) {
         for (int32 i = 0; i < count; ++i) {
             fullPalette[destinationBank][destBankStart + i] = fullPalette[sourceBank][srcBankStart + i];
@@ -92,6 +109,7 @@ inline void CopyPalette(uint8 sourceBank, uint8 srcBankStart, uint8 destinationB
 
 inline void RotatePalette(uint8 bankID, uint8 startIndex, uint8 endIndex, bool32 right)
 {
+    FlushPendingDraws();
     if (right) {
         uint16 startClr = fullPalette[bankID][endIndex];
         for (int32 i = endIndex; i > startIndex; --i) fullPalette[bankID][i] = fullPalette[bankID][i - 1];
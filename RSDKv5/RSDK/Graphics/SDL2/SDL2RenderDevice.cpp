@@ -85,16 +85,21 @@ void RenderDevice::CopyFrameBuffer()
     uint16 *pixels = NULL;
 
     for (int32 s = 0; s < videoSettings.screenCount; ++s) {
-        SDL_LockTexture(screenTexture[s], NULL, (void **)&pixels, &pitch);
+        uint32 bands = GetFrameBufferUploadBands(s);
 
-        uint16 *frameBuffer = screens[s].frameBuffer;
-        for (int32 y = 0; y < SCREEN_YSIZE; ++y) {
-            memcpy(pixels, frameBuffer, screens[s].size.x * sizeof(uint16));
-            frameBuffer += screens[s].pitch;
-            pixels += pitch / sizeof(uint16);
-        }
+        for (int32 y = 0, h = 0; GetNextFrameBufferUpload(bands, &y, &h); y += h) {
+            SDL_Rect rect = { 0, y, screens[s].size.x, h };
+            SDL_LockTexture(screenTexture[s], &rect, (void **)&pixels, &pitch);
+
+            uint16 *frameBuffer = &screens[s].frameBuffer[y * screens[s].pitch];
+            for (int32 r = 0; r < h; ++r) {
+                memcpy(pixels, frameBuffer, screens[s].size.x * sizeof(uint16));
+                frameBuffer += screens[s].pitch;
+                pixels += pitch / sizeof(uint16);
+            }
 
-        SDL_UnlockTexture(screenTexture[s]);
+            SDL_UnlockTexture(screenTexture[s]);
+        }
     }
 }
 
@@ -528,6 +533,7 @@ bool RenderDevice::InitGraphicsAPI()
         textureSize.y = 512.0;
     }
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+    ResetFrameBufferBands();
     for (int32 s = 0; s < SCREEN_COUNT; ++s) {
         screenTexture[s] = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGB565, SDL_TEXTUREACCESS_STREAMING, textureSize.x, textureSize.y);
 
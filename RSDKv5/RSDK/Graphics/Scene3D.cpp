@@ -2,9 +2,7 @@
 
 using namespace RSDK;
 
-#if RETRO_PLATFORM == RETRO_WIIU
-#include <algorithm>
-#endif
+#include <vector>
 
 #if RETRO_REV0U
 #include "Legacy/Scene3DLegacy.cpp"
@@ -15,12 +13,7 @@ Scene3D RSDK::scene3DList[SCENE3D_COUNT];
 
 ScanEdge RSDK::scanEdgeBuffer[SCREEN_YSIZE * 2];
 
-enum ModelFlags {
-    MODEL_NOFLAGS     = 0,
-    MODEL_USENORMALS  = 1 << 0,
-    MODEL_USETEXTURES = 1 << 1,
-    MODEL_USECOLOURS  = 1 << 2,
-};
+std::vector<Scene3DFace> faceSortBuffer;
 
 void RSDK::ProcessScanEdge(int32 x1, int32 y1, int32 x2, int32 y2)
 {
@@ -515,13 +508,186 @@ uint16 RSDK::Create3DScene(const char *name, uint16 vertexLimit, uint8 scope)
 
     return id;
 }
+#define SCENE3D_BATCH_SIZE (0x100)
+
+// model vertices get gathered into here so they can be interpolated & transformed a few at a time
+struct Scene3DVertexBatch {
+    int32 x[SCENE3D_BATCH_SIZE];
+    int32 y[SCENE3D_BATCH_SIZE];
+    int32 z[SCENE3D_BATCH_SIZE];
+
+    int32 nx[SCENE3D_BATCH_SIZE];
+    int32 ny[SCENE3D_BATCH_SIZE];
+    int32 nz[SCENE3D_BATCH_SIZE];
+};
+
+#if RETRO_SIMD_SSE2
+// SSE2 has no 32-bit mullo, so do the even & odd lanes separately and stitch the low halves back together
+inline __m128i MulShift8(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    __m128i mul  = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    return _mm_srai_epi32(mul, 8);
+}
+#elif RETRO_SIMD_NEON
+inline int32x4_t MulShift8(int32x4_t a, int32x4_t b) { return vshrq_n_s32(vmulq_s32(a, b), 8); }
+#endif
+
+void GatherModelVertices(Scene3DVertexBatch *batch, ModelVertex *vertices, uint16 *indices, int32 count, bool32 useNormals)
+{
+    for (int32 i = 0; i < count; ++i) {
+        ModelVertex *vert = &vertices[indices[i]];
+        batch->x[i]       = vert->x;
+        batch->y[i]       = vert->y;
+        batch->z[i]       = vert->z;
+    }
+
+    if (useNormals) {
+        for (int32 i = 0; i < count; ++i) {
+            ModelVertex *vert = &vertices[indices[i]];
+            batch->nx[i]      = vert->nx;
+            batch->ny[i]      = vert->ny;
+            batch->nz[i]      = vert->nz;
+        }
+    }
+}
+
+// values += (interpolate * (nextValues - values)) >> 8
+void LerpVertexBatch(int32 *values, int32 *nextValues, int32 interpolate, int32 count)
+{
+    int32 i = 0;
+
+#if RETRO_SIMD_SSE2
+    __m128i interp = _mm_set1_epi32(interpolate);
+    for (; i + 4 <= count; i += 4) {
+        __m128i value = _mm_loadu_si128((__m128i *)&values[i]);
+        __m128i next  = _mm_loadu_si128((__m128i *)&nextValues[i]);
+        _mm_storeu_si128((__m128i *)&values[i], _mm_add_epi32(value, MulShift8(interp, _mm_sub_epi32(next, value))));
+    }
+#elif RETRO_SIMD_NEON
+    int32x4_t interp = vdupq_n_s32(interpolate);
+    for (; i + 4 <= count; i += 4) {
+        int32x4_t value = vld1q_s32(&values[i]);
+        int32x4_t next  = vld1q_s32(&nextValues[i]);
+        vst1q_s32(&values[i], vaddq_s32(value, MulShift8(interp, vsubq_s32(next, value))));
+    }
+#endif
+
+    for (; i < count; ++i) values[i] += (interpolate * (nextValues[i] - values[i])) >> 8;
+}
+
+// transforms the batch in place, normals use the same math just without the translation
+void TransformVertexBatch(Matrix *matrix, bool32 translate, int32 *x, int32 *y, int32 *z, int32 count)
+{
+    int32 tx = translate ? matrix->values[0][3] : 0;
+    int32 ty = translate ? matrix->values[1][3] : 0;
+    int32 tz = translate ? matrix->values[2][3] : 0;
+
+    int32 i = 0;
+
+#if RETRO_SIMD_SSE2
+    __m128i m00 = _mm_set1_epi32(matrix->values[0][0]), m01 = _mm_set1_epi32(matrix->values[0][1]), m02 = _mm_set1_epi32(matrix->values[0][2]);
+    __m128i m10 = _mm_set1_epi32(matrix->values[1][0]), m11 = _mm_set1_epi32(matrix->values[1][1]), m12 = _mm_set1_epi32(matrix->values[1][2]);
+    __m128i m20 = _mm_set1_epi32(matrix->values[2][0]), m21 = _mm_set1_epi32(matrix->values[2][1]), m22 = _mm_set1_epi32(matrix->values[2][2]);
+    __m128i t0 = _mm_set1_epi32(tx), t1 = _mm_set1_epi32(ty), t2 = _mm_set1_epi32(tz);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128i vx = _mm_loadu_si128((__m128i *)&x[i]);
+        __m128i vy = _mm_loadu_si128((__m128i *)&y[i]);
+        __m128i vz = _mm_loadu_si128((__m128i *)&z[i]);
+
+        __m128i rx = _mm_add_epi32(_mm_add_epi32(t0, MulShift8(m00, vx)), _mm_add_epi32(MulShift8(m01, vy), MulShift8(m02, vz)));
+        __m128i ry = _mm_add_epi32(_mm_add_epi32(t1, MulShift8(m10, vx)), _mm_add_epi32(MulShift8(m11, vy), MulShift8(m12, vz)));
+        __m128i rz = _mm_add_epi32(_mm_add_epi32(t2, MulShift8(m20, vx)), _mm_add_epi32(MulShift8(m21, vy), MulShift8(m22, vz)));
+
+        _mm_storeu_si128((__m128i *)&x[i], rx);
+        _mm_storeu_si128((__m128i *)&y[i], ry);
+        _mm_storeu_si128((__m128i *)&z[i], rz);
+    }
+#elif RETRO_SIMD_NEON
+    int32x4_t m00 = vdupq_n_s32(matrix->values[0][0]), m01 = vdupq_n_s32(matrix->values[0][1]), m02 = vdupq_n_s32(matrix->values[0][2]);
+    int32x4_t m10 = vdupq_n_s32(matrix->values[1][0]), m11 = vdupq_n_s32(matrix->values[1][1]), m12 = vdupq_n_s32(matrix->values[1][2]);
+    int32x4_t m20 = vdupq_n_s32(matrix->values[2][0]), m21 = vdupq_n_s32(matrix->values[2][1]), m22 = vdupq_n_s32(matrix->values[2][2]);
+    int32x4_t t0 = vdupq_n_s32(tx), t1 = vdupq_n_s32(ty), t2 = vdupq_n_s32(tz);
+
+    for (; i + 4 <= count; i += 4) {
+        int32x4_t vx = vld1q_s32(&x[i]);
+        int32x4_t vy = vld1q_s32(&y[i]);
+        int32x4_t vz = vld1q_s32(&z[i]);
+
+        vst1q_s32(&x[i], vaddq_s32(vaddq_s32(t0, MulShift8(m00, vx)), vaddq_s32(MulShift8(m01, vy), MulShift8(m02, vz))));
+        vst1q_s32(&y[i], vaddq_s32(vaddq_s32(t1, MulShift8(m10, vx)), vaddq_s32(MulShift8(m11, vy), MulShift8(m12, vz))));
+        vst1q_s32(&z[i], vaddq_s32(vaddq_s32(t2, MulShift8(m20, vx)), vaddq_s32(MulShift8(m21, vy), MulShift8(m22, vz))));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        int32 vx = x[i];
+        int32 vy = y[i];
+        int32 vz = z[i];
+
+        x[i] = tx + (matrix->values[0][0] * vx >> 8) + (matrix->values[0][1] * vy >> 8) + (matrix->values[0][2] * vz >> 8);
+        y[i] = ty + (matrix->values[1][0] * vx >> 8) + (matrix->values[1][1] * vy >> 8) + (matrix->values[1][2] * vz >> 8);
+        z[i] = tz + (matrix->values[2][0] * vx >> 8) + (matrix->values[2][1] * vy >> 8) + (matrix->values[2][2] * vz >> 8);
+    }
+}
+
+// shared by AddModelToScene & AddMeshFrameToScene, nextFrameOffset is -1 if there's no interpolation to be done
+void AddModelVertices(Model *mdl, Scene3DVertex *vertices, int32 frameOffset, int32 nextFrameOffset, int32 interpolate, Matrix *matWorld,
+                      Matrix *matNormals, color color)
+{
+    // MODEL_USECOLOURS on its own (or any other combo) is treated the same as MODEL_NOFLAGS
+    bool32 useNormals = (mdl->flags == MODEL_USENORMALS || mdl->flags == (MODEL_USENORMALS | MODEL_USECOLOURS)) && matNormals;
+    bool32 useColors  = mdl->flags == (MODEL_USENORMALS | MODEL_USECOLOURS);
+
+    Scene3DVertexBatch batch;
+    Scene3DVertexBatch nextBatch;
+    for (int32 start = 0; start < mdl->indexCount; start += SCENE3D_BATCH_SIZE) {
+        int32 count     = MIN(mdl->indexCount - start, SCENE3D_BATCH_SIZE);
+        uint16 *indices = &mdl->indices[start];
+
+        GatherModelVertices(&batch, &mdl->vertices[frameOffset], indices, count, useNormals);
+        if (nextFrameOffset >= 0) {
+            GatherModelVertices(&nextBatch, &mdl->vertices[nextFrameOffset], indices, count, useNormals);
+
+            LerpVertexBatch(batch.x, nextBatch.x, interpolate, count);
+            LerpVertexBatch(batch.y, nextBatch.y, interpolate, count);
+            LerpVertexBatch(batch.z, nextBatch.z, interpolate, count);
+            if (useNormals) {
+                LerpVertexBatch(batch.nx, nextBatch.nx, interpolate, count);
+                LerpVertexBatch(batch.ny, nextBatch.ny, interpolate, count);
+                LerpVertexBatch(batch.nz, nextBatch.nz, interpolate, count);
+            }
+        }
+
+        TransformVertexBatch(matWorld, true, batch.x, batch.y, batch.z, count);
+        if (useNormals)
+            TransformVertexBatch(matNormals, false, batch.nx, batch.ny, batch.nz, count);
+
+        Scene3DVertex *vertex = &vertices[start];
+        for (int32 i = 0; i < count; ++i, ++vertex) {
+            vertex->x = batch.x[i];
+            vertex->y = batch.y[i];
+            vertex->z = batch.z[i];
+
+            if (useNormals) {
+                vertex->nx = batch.nx[i];
+                vertex->ny = batch.ny[i];
+                vertex->nz = batch.nz[i];
+            }
+
+            vertex->color = useColors ? mdl->colors[indices[i]].color : color;
+        }
+    }
+}
+
 void RSDK::AddModelToScene(uint16 modelFrames, uint16 sceneIndex, uint8 drawMode, Matrix *matWorld, Matrix *matNormals, color color)
 {
     if (modelFrames < MODEL_COUNT && sceneIndex < SCENE3D_COUNT) {
         if (matWorld) {
             Model *mdl            = &modelList[modelFrames];
             Scene3D *scn          = &scene3DList[sceneIndex];
-            uint16 *indices       = mdl->indices;
             int32 vertID          = scn->vertexCount;
             uint8 *faceVertCounts = &scn->faceVertCounts[scn->faceCount];
             int32 indCnt          = mdl->indexCount;
@@ -530,131 +696,8 @@ void RSDK::AddModelToScene(uint16 modelFrames, uint16 sceneIndex, uint8 drawMode
                 scn->drawMode = drawMode;
                 scn->faceCount += indCnt / mdl->faceVertCount;
 
-                int32 i = 0;
-                int32 f = 0;
-                switch (mdl->flags) {
-                    default:
-                    case MODEL_NOFLAGS:
-                    case MODEL_USECOLOURS:
-                        for (; i < mdl->indexCount;) {
-                            faceVertCounts[f++] = mdl->faceVertCount;
-
-                            for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                ModelVertex *modelVert = &mdl->vertices[indices[i++]];
-                                Scene3DVertex *vertex  = &scn->vertices[vertID++];
-
-                                vertex->x = matWorld->values[0][3] + (modelVert->z * matWorld->values[0][2] >> 8)
-                                            + (matWorld->values[0][0] * modelVert->x >> 8) + (matWorld->values[0][1] * modelVert->y >> 8);
-                                vertex->y = matWorld->values[1][3] + (modelVert->y * matWorld->values[1][1] >> 8)
-                                            + (modelVert->z * matWorld->values[1][2] >> 8) + (matWorld->values[1][0] * modelVert->x >> 8);
-                                vertex->z = matWorld->values[2][3] + ((modelVert->x * matWorld->values[2][0]) >> 8)
-                                            + ((matWorld->values[2][2] * modelVert->z >> 8) + (matWorld->values[2][1] * modelVert->y >> 8));
-
-                                vertex->color = color;
-                            }
-                        }
-                        break;
-
-                    case MODEL_USENORMALS:
-                        if (matNormals) {
-                            for (; i < mdl->indexCount;) {
-                                faceVertCounts[f++] = mdl->faceVertCount;
-
-                                for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                    ModelVertex *modelVert = &mdl->vertices[indices[i++]];
-                                    Scene3DVertex *vertex  = &scn->vertices[vertID++];
-
-                                    vertex->x = matWorld->values[0][3] + (modelVert->z * matWorld->values[0][2] >> 8)
-                                                + (modelVert->x * matWorld->values[0][0] >> 8) + (modelVert->y * matWorld->values[0][1] >> 8);
-                                    vertex->y = matWorld->values[1][3] + (modelVert->y * matWorld->values[1][1] >> 8)
-                                                + (matWorld->values[1][0] * modelVert->x >> 8) + (modelVert->z * matWorld->values[1][2] >> 8);
-                                    vertex->z = matWorld->values[2][3] + (modelVert->x * matWorld->values[2][0] >> 8)
-                                                + (matWorld->values[2][2] * modelVert->z >> 8) + (matWorld->values[2][1] * modelVert->y >> 8);
-
-                                    vertex->nx = (modelVert->nz * matNormals->values[0][2] >> 8) + (modelVert->nx * matNormals->values[0][0] >> 8)
-                                                 + (matNormals->values[0][1] * modelVert->ny >> 8);
-                                    vertex->ny = (modelVert->ny * matNormals->values[1][1] >> 8) + (modelVert->nz * matNormals->values[1][2] >> 8)
-                                                 + (modelVert->nx * matNormals->values[1][0] >> 8);
-                                    vertex->nz =
-                                        ((modelVert->ny * matNormals->values[2][1]) >> 8)
-                                        + ((matNormals->values[2][0] * modelVert->nx >> 8) + (modelVert->nz * matNormals->values[2][2] >> 8));
-
-                                    vertex->color = color;
-                                }
-                            }
-                        }
-                        else {
-                            for (; i < mdl->indexCount;) {
-                                faceVertCounts[f++] = mdl->faceVertCount;
-
-                                for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                    ModelVertex *modelVert = &mdl->vertices[indices[i++]];
-                                    Scene3DVertex *vertex  = &scn->vertices[vertID++];
-
-                                    vertex->x = matWorld->values[0][3] + (modelVert->z * matWorld->values[0][2] >> 8)
-                                                + (matWorld->values[0][0] * modelVert->x >> 8) + (matWorld->values[0][1] * modelVert->y >> 8);
-                                    vertex->y = matWorld->values[1][3] + (modelVert->y * matWorld->values[1][1] >> 8)
-                                                + (modelVert->z * matWorld->values[1][2] >> 8) + (matWorld->values[1][0] * modelVert->x >> 8);
-                                    vertex->z = matWorld->values[2][3] + ((matWorld->values[2][2] * modelVert->z) >> 8)
-                                                + ((matWorld->values[2][0] * modelVert->x >> 8) + (matWorld->values[2][1] * modelVert->y >> 8));
-
-                                    vertex->color = color;
-                                }
-                            }
-                        }
-                        break;
-
-                    case MODEL_USENORMALS | MODEL_USECOLOURS:
-                        if (matNormals) {
-                            for (; i < mdl->indexCount;) {
-                                faceVertCounts[f++] = mdl->faceVertCount;
-
-                                for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                    ModelVertex *modelVert = &mdl->vertices[indices[i]];
-                                    Color *modelColor      = &mdl->colors[indices[i++]];
-                                    Scene3DVertex *vertex  = &scn->vertices[vertID++];
-
-                                    vertex->x = matWorld->values[0][3] + (matWorld->values[0][2] * modelVert->z >> 8)
-                                                + (modelVert->y * matWorld->values[0][1] >> 8) + (matWorld->values[0][0] * modelVert->x >> 8);
-                                    vertex->y = matWorld->values[1][3] + (matWorld->values[1][2] * modelVert->z >> 8)
-                                                + (modelVert->y * matWorld->values[1][1] >> 8) + (matWorld->values[1][0] * modelVert->x >> 8);
-                                    vertex->z = matWorld->values[2][3] + (modelVert->x * matWorld->values[2][0] >> 8)
-                                                + (modelVert->y * matWorld->values[2][1] >> 8) + (matWorld->values[2][2] * modelVert->z >> 8);
-
-                                    vertex->nx = (matNormals->values[0][0] * modelVert->nx >> 8) + (modelVert->ny * matNormals->values[0][1] >> 8)
-                                                 + (matNormals->values[0][2] * modelVert->nz >> 8);
-                                    vertex->ny = (matNormals->values[1][0] * modelVert->nx >> 8) + (modelVert->ny * matNormals->values[1][1] >> 8)
-                                                 + (matNormals->values[1][2] * modelVert->nz >> 8);
-                                    vertex->nz =
-                                        ((matNormals->values[2][2] * modelVert->nz) >> 8)
-                                        + ((modelVert->ny * matNormals->values[2][1] >> 8) + (matNormals->values[2][0] * modelVert->nx >> 8));
-
-                                    vertex->color = modelColor->color;
-                                }
-                            }
-                        }
-                        else {
-                            for (; i < mdl->indexCount;) {
-                                faceVertCounts[f++] = mdl->faceVertCount;
-
-                                for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                    ModelVertex *modelVert = &mdl->vertices[indices[i]];
-                                    Color *modelColor      = &mdl->colors[indices[i++]];
-                                    Scene3DVertex *vertex  = &scn->vertices[vertID++];
-
-                                    vertex->x = matWorld->values[0][3] + (matWorld->values[0][0] * modelVert->x >> 8)
-                                                + (modelVert->y * matWorld->values[0][1] >> 8) + (modelVert->z * matWorld->values[0][2] >> 8);
-                                    vertex->y = matWorld->values[1][3] + (modelVert->z * matWorld->values[1][2] >> 8)
-                                                + (matWorld->values[1][0] * modelVert->x >> 8) + (modelVert->y * matWorld->values[1][1] >> 8);
-                                    vertex->z = matWorld->values[2][3] + (matWorld->values[2][2] * modelVert->z >> 8)
-                                                + (modelVert->y * matWorld->values[2][1] >> 8) + (modelVert->x * matWorld->values[2][0] >> 8);
-
-                                    vertex->color = modelColor->color;
-                                }
-                            }
-                        }
-                        break;
-                }
+                memset(faceVertCounts, mdl->faceVertCount, indCnt / mdl->faceVertCount);
+                AddModelVertices(mdl, &scn->vertices[vertID], 0, -1, 0, matWorld, matNormals, color);
             }
         }
     }
@@ -666,7 +709,6 @@ void RSDK::AddMeshFrameToScene(uint16 modelFrames, uint16 sceneIndex, Animator *
         if (matWorld && animator) {
             Model *mdl            = &modelList[modelFrames];
             Scene3D *scn          = &scene3DList[sceneIndex];
-            uint16 *indices       = mdl->indices;
             int32 vertID          = scn->vertexCount;
             uint8 *faceVertCounts = &scn->faceVertCounts[scn->faceCount];
             int32 indCnt          = mdl->indexCount;
@@ -681,149 +723,8 @@ void RSDK::AddMeshFrameToScene(uint16 modelFrames, uint16 sceneIndex, Animator *
                 int32 frameOffset     = animator->frameID * mdl->vertCount;
                 int32 nextFrameOffset = nextFrame * mdl->vertCount;
 
-                int32 i           = 0;
-                int32 f           = 0;
-                int32 interpolate = animator->timer;
-                switch (mdl->flags) {
-                    default:
-                    case MODEL_NOFLAGS:
-                    case MODEL_USECOLOURS:
-                        for (; i < mdl->indexCount;) {
-                            faceVertCounts[f++] = mdl->faceVertCount;
-
-                            for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                ModelVertex *frameVert     = &mdl->vertices[frameOffset + indices[i]];
-                                ModelVertex *nextFrameVert = &mdl->vertices[nextFrameOffset + indices[i]];
-                                int32 x                    = frameVert->x + ((interpolate * (nextFrameVert->x - frameVert->x)) >> 8);
-                                int32 y                    = frameVert->y + ((interpolate * (nextFrameVert->y - frameVert->y)) >> 8);
-                                int32 z                    = frameVert->z + ((interpolate * (nextFrameVert->z - frameVert->z)) >> 8);
-                                i++;
-                                Scene3DVertex *vertex = &scn->vertices[vertID++];
-                                vertex->x             = matWorld->values[0][3] + (z * matWorld->values[0][2] >> 8) + (matWorld->values[0][0] * x >> 8)
-                                            + (matWorld->values[0][1] * y >> 8);
-                                vertex->y = matWorld->values[1][3] + (y * matWorld->values[1][1] >> 8) + (z * matWorld->values[1][2] >> 8)
-                                            + (matWorld->values[1][0] * x >> 8);
-                                vertex->z = matWorld->values[2][3] + ((x * matWorld->values[2][0]) >> 8)
-                                            + ((matWorld->values[2][2] * z >> 8) + (matWorld->values[2][1] * y >> 8));
-                                vertex->color = color;
-                            }
-                        }
-                        break;
-
-                    case MODEL_USENORMALS:
-                        if (matNormals) {
-                            for (; i < mdl->indexCount;) {
-                                faceVertCounts[f++] = mdl->faceVertCount;
-
-                                for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                    ModelVertex *frameVert     = &mdl->vertices[frameOffset + indices[i]];
-                                    ModelVertex *nextFrameVert = &mdl->vertices[nextFrameOffset + indices[i]];
-                                    int32 x                    = frameVert->x + ((interpolate * (nextFrameVert->x - frameVert->x)) >> 8);
-                                    int32 y                    = frameVert->y + ((interpolate * (nextFrameVert->y - frameVert->y)) >> 8);
-                                    int32 z                    = frameVert->z + ((interpolate * (nextFrameVert->z - frameVert->z)) >> 8);
-                                    int32 nx                   = frameVert->nx + ((interpolate * (nextFrameVert->nx - frameVert->nx)) >> 8);
-                                    int32 ny                   = frameVert->ny + ((interpolate * (nextFrameVert->ny - frameVert->ny)) >> 8);
-                                    int32 nz                   = frameVert->nz + ((interpolate * (nextFrameVert->nz - frameVert->nz)) >> 8);
-                                    i++;
-
-                                    Scene3DVertex *vertex = &scn->vertices[vertID++];
-                                    vertex->x = matWorld->values[0][3] + (z * matWorld->values[0][2] >> 8) + (x * matWorld->values[0][0] >> 8)
-                                                + (y * matWorld->values[0][1] >> 8);
-                                    vertex->y = matWorld->values[1][3] + (y * matWorld->values[1][1] >> 8) + (matWorld->values[1][0] * x >> 8)
-                                                + (z * matWorld->values[1][2] >> 8);
-                                    vertex->z = matWorld->values[2][3] + (x * matWorld->values[2][0] >> 8) + (matWorld->values[2][2] * z >> 8)
-                                                + (matWorld->values[2][1] * y >> 8);
-                                    vertex->nx = (nz * matNormals->values[0][2] >> 8) + (nx * matNormals->values[0][0] >> 8)
-                                                 + (matNormals->values[0][1] * ny >> 8);
-                                    vertex->ny = (ny * matNormals->values[1][1] >> 8) + (nz * matNormals->values[1][2] >> 8)
-                                                 + (nx * matNormals->values[1][0] >> 8);
-                                    vertex->nz = ((ny * matNormals->values[2][1]) >> 8)
-                                                 + ((matNormals->values[2][0] * nx >> 8) + (nz * matNormals->values[2][2] >> 8));
-                                    vertex->color = color;
-                                }
-                            }
-                        }
-                        else {
-                            for (; i < mdl->indexCount;) {
-                                faceVertCounts[f++] = mdl->faceVertCount;
-
-                                for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                    ModelVertex *frameVert     = &mdl->vertices[frameOffset + indices[i]];
-                                    ModelVertex *nextFrameVert = &mdl->vertices[nextFrameOffset + indices[i]];
-                                    int32 x                    = frameVert->x + ((interpolate * (nextFrameVert->x - frameVert->x)) >> 8);
-                                    int32 y                    = frameVert->y + ((interpolate * (nextFrameVert->y - frameVert->y)) >> 8);
-                                    int32 z                    = frameVert->z + ((interpolate * (nextFrameVert->z - frameVert->z)) >> 8);
-                                    i++;
-                                    Scene3DVertex *vertex = &scn->vertices[vertID++];
-                                    vertex->x = matWorld->values[0][3] + (z * matWorld->values[0][2] >> 8) + (matWorld->values[0][0] * x >> 8)
-                                                + (matWorld->values[0][1] * y >> 8);
-                                    vertex->y = matWorld->values[1][3] + (y * matWorld->values[1][1] >> 8) + (z * matWorld->values[1][2] >> 8)
-                                                + (matWorld->values[1][0] * x >> 8);
-                                    vertex->z = matWorld->values[2][3] + ((matWorld->values[2][2] * z) >> 8)
-                                                + ((matWorld->values[2][0] * x >> 8) + (matWorld->values[2][1] * y >> 8));
-                                    vertex->color = color;
-                                }
-                            }
-                        }
-                        break;
-
-                    case MODEL_USENORMALS | MODEL_USECOLOURS:
-                        if (matNormals) {
-                            for (; i < mdl->indexCount;) {
-                                faceVertCounts[f++] = mdl->faceVertCount;
-
-                                for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                    ModelVertex *frameVert     = &mdl->vertices[frameOffset + indices[i]];
-                                    ModelVertex *nextFrameVert = &mdl->vertices[nextFrameOffset + indices[i]];
-                                    int32 x                    = frameVert->x + ((interpolate * (nextFrameVert->x - frameVert->x)) >> 8);
-                                    int32 y                    = frameVert->y + ((interpolate * (nextFrameVert->y - frameVert->y)) >> 8);
-                                    int32 z                    = frameVert->z + ((interpolate * (nextFrameVert->z - frameVert->z)) >> 8);
-                                    int32 nx                   = frameVert->nx + ((interpolate * (nextFrameVert->nx - frameVert->nx)) >> 8);
-                                    int32 ny                   = frameVert->ny + ((interpolate * (nextFrameVert->ny - frameVert->ny)) >> 8);
-                                    int32 nz                   = frameVert->nz + ((interpolate * (nextFrameVert->nz - frameVert->nz)) >> 8);
-
-                                    Color *modelColor     = &mdl->colors[indices[i++]];
-                                    Scene3DVertex *vertex = &scn->vertices[vertID++];
-                                    vertex->x = matWorld->values[0][3] + (matWorld->values[0][2] * z >> 8) + (y * matWorld->values[0][1] >> 8)
-                                                + (matWorld->values[0][0] * x >> 8);
-                                    vertex->y = matWorld->values[1][3] + (matWorld->values[1][2] * z >> 8) + (y * matWorld->values[1][1] >> 8)
-                                                + (matWorld->values[1][0] * x >> 8);
-                                    vertex->z = matWorld->values[2][3] + (x * matWorld->values[2][0] >> 8) + (y * matWorld->values[2][1] >> 8)
-                                                + (matWorld->values[2][2] * z >> 8);
-                                    vertex->nx = (matNormals->values[0][0] * nx >> 8) + (ny * matNormals->values[0][1] >> 8)
-                                                 + (matNormals->values[0][2] * nz >> 8);
-                                    vertex->ny = (matNormals->values[1][0] * nx >> 8) + (ny * matNormals->values[1][1] >> 8)
-                                                 + (matNormals->values[1][2] * nz >> 8);
-                                    vertex->nz = ((matNormals->values[2][2] * nz) >> 8)
-                                                 + ((ny * matNormals->values[2][1] >> 8) + (matNormals->values[2][0] * nx >> 8));
-                                    vertex->color = modelColor->color;
-                                }
-                            }
-                        }
-                        else {
-                            for (; i < mdl->indexCount;) {
-                                faceVertCounts[f++] = mdl->faceVertCount;
-
-                                for (int32 c = 0; c < mdl->faceVertCount; ++c) {
-                                    ModelVertex *frameVert     = &mdl->vertices[frameOffset + indices[i]];
-                                    ModelVertex *nextFrameVert = &mdl->vertices[nextFrameOffset + indices[i]];
-                                    int32 x                    = frameVert->x + ((interpolate * (nextFrameVert->x - frameVert->x)) >> 8);
-                                    int32 y                    = frameVert->y + ((interpolate * (nextFrameVert->y - frameVert->y)) >> 8);
-                                    int32 z                    = frameVert->z + ((interpolate * (nextFrameVert->z - frameVert->z)) >> 8);
-                                    Color *modelColor          = &mdl->colors[indices[i++]];
-                                    Scene3DVertex *vertex      = &scn->vertices[vertID++];
-                                    vertex->x = matWorld->values[0][3] + (matWorld->values[0][0] * x >> 8) + (y * matWorld->values[0][1] >> 8)
-                                                + (z * matWorld->values[0][2] >> 8);
-                                    vertex->y = matWorld->values[1][3] + (z * matWorld->values[1][2] >> 8) + (matWorld->values[1][0] * x >> 8)
-                                                + (y * matWorld->values[1][1] >> 8);
-                                    vertex->z = matWorld->values[2][3] + (matWorld->values[2][2] * z >> 8) + (y * matWorld->values[2][1] >> 8)
-                                                + (x * matWorld->values[2][0] >> 8);
-                                    vertex->color = modelColor->color;
-                                }
-                            }
-                        }
-                        break;
-                }
+                memset(faceVertCounts, mdl->faceVertCount, indCnt / mdl->faceVertCount);
+                AddModelVertices(mdl, &scn->vertices[vertID], frameOffset, nextFrameOffset, animator->timer, matWorld, matNormals, color);
             }
         }
     }
@@ -880,30 +781,10 @@ void RSDK::Draw3DScene(uint16 sceneID)
         }
 
         // Sort the face buffer. This is needed so that the faces don't overlap each other incorrectly when they're rendered.
-        // This is an insertion sort, taken from here:
-        // https://web.archive.org/web/20110108233032/http://rosettacode.org/wiki/Sorting_algorithms/Insertion_sort#C
-
-        Scene3DFace *a = scn->faceBuffer;
-
-#if RETRO_PLATFORM == RETRO_WIIU
-        // Use the faster std::stable_sort instead
-        std::stable_sort(a, a + scn->faceCount, [](const Scene3DFace &a, const Scene3DFace &b) { return a.depth > b.depth; });
-#else
-        int i, j;
-        Scene3DFace temp;
-
-        for(i=1; i<scn->faceCount; i++)
-        {
-            temp = a[i];
-            j = i-1;
-            while(j>=0 && a[j].depth < temp.depth)
-            {
-                a[j+1] = a[j];
-                j -= 1;
-            }
-            a[j+1] = temp;
-        }
-#endif
+        if (faceSortBuffer.size() < scn->faceCount)
+            faceSortBuffer.resize(scn->faceCount);
+        SortFacesByDepth(scn->faceBuffer, faceSortBuffer.data(), scn->faceCount);
+
         // Finally, display the faces.
 
         uint8 *vertCnt = scn->faceVertCounts;
@@ -927,16 +808,17 @@ void RSDK::Draw3DScene(uint16 sceneID)
                 break;
 
             case S3D_SOLIDCOLOR:
+                BeginFaceBatch(entity->alpha, entity->inkEffect);
                 for (int32 f = 0; f < scn->faceCount; ++f) {
                     Scene3DVertex *drawVert = &scn->vertices[scn->faceBuffer[f].index];
                     for (int32 v = 0; v < *vertCnt; ++v) {
                         vertPos[v].x = (drawVert[v].x << 8) - (currentScreen->position.x << 16);
                         vertPos[v].y = (drawVert[v].y << 8) - (currentScreen->position.y << 16);
                     }
-                    DrawFace(vertPos, *vertCnt, (drawVert->color >> 16) & 0xFF, (drawVert->color >> 8) & 0xFF, (drawVert->color >> 0) & 0xFF,
-                             entity->alpha, entity->inkEffect);
+                    AddFaceToBatch(vertPos, *vertCnt, (drawVert->color >> 16) & 0xFF, (drawVert->color >> 8) & 0xFF, (drawVert->color >> 0) & 0xFF);
                     vertCnt++;
                 }
+                DrawFaceBatch();
                 break;
 
             // Might have been reserved for textures?
@@ -987,6 +869,7 @@ void RSDK::Draw3DScene(uint16 sceneID)
                 break;
 
             case S3D_SOLIDCOLOR_SHADED:
+                BeginFaceBatch(entity->alpha, entity->inkEffect);
                 for (int32 f = 0; f < scn->faceCount; ++f) {
                     Scene3DVertex *drawVert = &scn->vertices[scn->faceBuffer[f].index];
                     int32 vertCount         = *vertCnt;
@@ -1020,10 +903,11 @@ void RSDK::Draw3DScene(uint16 sceneID)
                     uint32 color = (r << 16) | (g << 8) | (b << 0);
 
                     drawVert = &scn->vertices[scn->faceBuffer[f].index];
-                    DrawFace(vertPos, *vertCnt, (color >> 16) & 0xFF, (color >> 8) & 0xFF, (color >> 0) & 0xFF, entity->alpha, entity->inkEffect);
+                    AddFaceToBatch(vertPos, *vertCnt, (color >> 16) & 0xFF, (color >> 8) & 0xFF, (color >> 0) & 0xFF);
 
                     vertCnt++;
                 }
+                DrawFaceBatch();
                 break;
 
             case S3D_SOLIDCOLOR_SHADED_BLENDED:
@@ -1093,6 +977,7 @@ void RSDK::Draw3DScene(uint16 sceneID)
                 break;
 
             case S3D_SOLIDCOLOR_SCREEN:
+                BeginFaceBatch(entity->alpha, entity->inkEffect);
                 for (int32 f = 0; f < scn->faceCount; ++f) {
                     Scene3DVertex *drawVert = &scn->vertices[scn->faceBuffer[f].index];
                     int32 vertCount         = *vertCnt;
@@ -1110,11 +995,12 @@ void RSDK::Draw3DScene(uint16 sceneID)
                     }
 
                     if (v < 0xFF) {
-                        DrawFace(vertPos, *vertCnt, (drawVert[0].color >> 16) & 0xFF, (drawVert[0].color >> 8) & 0xFF,
-                                 (drawVert[0].color >> 0) & 0xFF, entity->alpha, entity->inkEffect);
+                        AddFaceToBatch(vertPos, *vertCnt, (drawVert[0].color >> 16) & 0xFF, (drawVert[0].color >> 8) & 0xFF,
+                                       (drawVert[0].color >> 0) & 0xFF);
                     }
                     vertCnt++;
                 }
+                DrawFaceBatch();
                 break;
 
             case S3D_WIREFRAME_SHADED_SCREEN:
@@ -1171,6 +1057,7 @@ void RSDK::Draw3DScene(uint16 sceneID)
                 break;
 
             case S3D_SOLIDCOLOR_SHADED_SCREEN:
+                BeginFaceBatch(entity->alpha, entity->inkEffect);
                 for (int32 f = 0; f < scn->faceCount; ++f) {
                     Scene3DVertex *drawVert = &scn->vertices[scn->faceBuffer[f].index];
                     int32 vertCount         = *vertCnt;
@@ -1212,11 +1099,12 @@ void RSDK::Draw3DScene(uint16 sceneID)
                         uint32 color = (r << 16) | (g << 8) | (b << 0);
 
                         drawVert = &scn->vertices[scn->faceBuffer[f].index];
-                        DrawFace(vertPos, *vertCnt, (color >> 16) & 0xFF, (color >> 8) & 0xFF, (color >> 0) & 0xFF, entity->alpha, entity->inkEffect);
+                        AddFaceToBatch(vertPos, *vertCnt, (color >> 16) & 0xFF, (color >> 8) & 0xFF, (color >> 0) & 0xFF);
                     }
 
                     vertCnt++;
                 }
+                DrawFaceBatch();
                 break;
 
             case S3D_SOLIDCOLOR_SHADED_BLENDED_SCREEN:
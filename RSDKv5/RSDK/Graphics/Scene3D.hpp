@@ -31,6 +31,13 @@ enum Scene3DDrawTypes {
     S3D_SOLIDCOLOR_SHADED_BLENDED_SCREEN,
 };
 
+enum ModelFlags {
+    MODEL_NOFLAGS     = 0,
+    MODEL_USENORMALS  = 1 << 0,
+    MODEL_USETEXTURES = 1 << 1,
+    MODEL_USECOLOURS  = 1 << 2,
+};
+
 struct ScanEdge {
     int32 start;
     int32 end;
@@ -224,6 +231,54 @@ void AddMeshFrameToScene(uint16 modelFrames, uint16 sceneIndex, Animator *animat
 void Sort3DDrawList(Scene3D *scn, int32 first, int32 last);
 void Draw3DScene(uint16 sceneID);
 
+// stable LSD radix sort for 3D draw lists, sorts back to front (highest depth first)
+// faces with equal depths keep the order they were added in, same as the insertion/bubble sorts this replaced
+// scratch needs to be able to hold count entries
+template <typename T> void SortFacesByDepth(T *faces, T *scratch, int32 count)
+{
+    if (count < 2)
+        return;
+
+    // flip the sign bit so signed depths sort correctly as unsigned keys, then invert so higher depths come first
+    auto getKey = [](const T &face) { return ~((uint32)face.depth ^ 0x80000000); };
+
+    int32 counts[4][0x100];
+    memset(counts, 0, sizeof(counts));
+    for (int32 i = 0; i < count; ++i) {
+        uint32 key = getKey(faces[i]);
+        ++counts[0][key & 0xFF];
+        ++counts[1][(key >> 8) & 0xFF];
+        ++counts[2][(key >> 16) & 0xFF];
+        ++counts[3][key >> 24];
+    }
+
+    T *src = faces;
+    T *dst = scratch;
+    for (int32 p = 0; p < 4; ++p) {
+        int32 shift = p * 8;
+
+        // every face has the same byte here, so this pass wouldn't change anything
+        if (counts[p][(getKey(src[0]) >> shift) & 0xFF] == count)
+            continue;
+
+        int32 offset = 0;
+        for (int32 b = 0; b < 0x100; ++b) {
+            int32 size   = counts[p][b];
+            counts[p][b] = offset;
+            offset += size;
+        }
+
+        for (int32 i = 0; i < count; ++i) dst[counts[p][(getKey(src[i]) >> shift) & 0xFF]++] = src[i];
+
+        T *temp = src;
+        src     = dst;
+        dst     = temp;
+    }
+
+    if (src != faces)
+        memcpy(faces, src, count * sizeof(T));
+}
+
 inline void Clear3DScenes()
 {
     // Unload Models
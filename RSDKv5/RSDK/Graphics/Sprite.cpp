@@ -950,7 +950,8 @@ uint16 RSDK::LoadSpriteSheet(const char *filename, uint8 scope)
             surface->lineSize = ls;
         }
 
-        surface->pixels = NULL;
+        surface->pixels   = NULL;
+        surface->runTable = NULL;
         AllocateStorage((void **)&surface->pixels, surface->width * surface->height, DATASET_STG, false);
         image.pixels = surface->pixels;
         image.Load(NULL, false);
@@ -961,6 +962,8 @@ uint16 RSDK::LoadSpriteSheet(const char *filename, uint8 scope)
 #endif
         image.Close();
 
+        BuildSurfaceRuns(surface);
+
         return id;
     }
     else {
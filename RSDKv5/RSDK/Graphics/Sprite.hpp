@@ -60,13 +60,27 @@ struct GifDecoder {
 
 struct ImageGIF : public Image {
     ImageGIF() { AllocateStorage((void **)&decoder, sizeof(GifDecoder), DATASET_TMP, true); }
+    // the decoder & palette are owned by the caller here, so loading won't touch storage (used for loading off the main thread)
+    ImageGIF(GifDecoder *decoder, color *palette)
+    {
+        this->decoder   = decoder;
+        this->palette   = palette;
+        externalStorage = true;
+    }
 #if !RETRO_USE_ORIGINAL_CODE
-    ~ImageGIF() { RemoveStorageEntry((void **)&decoder); }
+    ~ImageGIF()
+    {
+        if (externalStorage)
+            palette = NULL;
+        else
+            RemoveStorageEntry((void **)&decoder);
+    }
 #endif
 
     bool32 Load(const char *fileName, bool32 loadHeader);
 
     GifDecoder *decoder;
+    bool32 externalStorage = false;
 };
 
 #if RETRO_REV02
@@ -1,5 +1,10 @@
 #include "RSDK/Core/RetroEngine.hpp"
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
 using namespace RSDK;
 
 FileInfo VideoManager::file;
@@ -18,6 +23,155 @@ th_pixel_fmt VideoManager::pixelFormat;
 ogg_int64_t VideoManager::granulePos = 0;
 bool32 VideoManager::initializing    = false;
 
+// demuxing & decoding happens on its own thread, which keeps a few frames decoded ahead of time
+// the main thread just picks out whichever frame lines up with the stream position
+#define VIDEO_FRAME_QUEUE_SIZE (4)
+
+struct VideoFrame {
+    double endTime; // from th_granule_time, this is when the frame should stop being displayed
+    std::vector<uint8> planes[3];
+    int32 width[3];
+    int32 height[3];
+    int32 stride[3];
+};
+
+VideoFrame videoFrames[VIDEO_FRAME_QUEUE_SIZE];
+int32 videoFrameHead  = 0;
+int32 videoFrameCount = 0;
+bool32 videoDecodeFinished = false;
+bool32 videoDecodeStop     = false;
+double videoFrameEndTime   = 0.0;
+std::thread videoDecodeThread;
+std::mutex videoFrameMutex;
+std::condition_variable videoFrameSignal;
+
+// reads the next packet & decodes it, returns false once the file runs out
+bool32 DecodeVideoFrame(th_ycbcr_buffer yuv, double *endTime)
+{
+    while (true) {
+        while (ogg_stream_packetout(&VideoManager::to, &VideoManager::op) <= 0) {
+            char *buffer = ogg_sync_buffer(&VideoManager::oy, 0x1000);
+            int32 size   = (int32)ReadBytes(&VideoManager::file, buffer, 0x1000);
+            if (!size)
+                return false;
+
+            ogg_sync_wrote(&VideoManager::oy, size);
+
+            while (ogg_sync_pageout(&VideoManager::oy, &VideoManager::og) > 0) ogg_stream_pagein(&VideoManager::to, &VideoManager::og);
+        }
+
+        // dupe frames still need to take up their slot in time, so they get output like any other frame
+        int32 result = th_decode_packetin(VideoManager::td, &VideoManager::op, &VideoManager::granulePos);
+        if (result == 0 || result == TH_DUPFRAME) {
+            th_decode_ycbcr_out(VideoManager::td, yuv);
+            *endTime = th_granule_time(VideoManager::td, VideoManager::granulePos);
+            return true;
+        }
+    }
+}
+
+void VideoDecodeLoop()
+{
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(videoFrameMutex);
+            videoFrameSignal.wait(lock, [] { return videoDecodeStop || videoFrameCount < VIDEO_FRAME_QUEUE_SIZE; });
+            if (videoDecodeStop)
+                return;
+        }
+
+        th_ycbcr_buffer yuv;
+        double endTime = 0.0;
+        if (!DecodeVideoFrame(yuv, &endTime)) {
+            std::lock_guard<std::mutex> lock(videoFrameMutex);
+            videoDecodeFinished = true;
+            videoFrameSignal.notify_all();
+            return;
+        }
+
+        // only this thread writes to the tail slot, so the copy can happen without holding the lock
+        VideoFrame *frame = &videoFrames[(videoFrameHead + videoFrameCount) % VIDEO_FRAME_QUEUE_SIZE];
+        frame->endTime    = endTime;
+        for (int32 p = 0; p < 3; ++p) {
+            // theora is free to hand back planes with negative strides, so copy them top-down with a positive one
+            int32 stride     = abs(yuv[p].stride);
+            frame->width[p]  = yuv[p].width;
+            frame->height[p] = yuv[p].height;
+            frame->stride[p] = stride;
+            frame->planes[p].resize(stride * yuv[p].height);
+
+            for (int32 y = 0; y < yuv[p].height; ++y) memcpy(&frame->planes[p][y * stride], yuv[p].data + y * yuv[p].stride, yuv[p].width);
+        }
+
+        std::lock_guard<std::mutex> lock(videoFrameMutex);
+        ++videoFrameCount;
+        videoFrameSignal.notify_all();
+    }
+}
+
+void StopVideoDecoding()
+{
+    {
+        std::lock_guard<std::mutex> lock(videoFrameMutex);
+        videoDecodeStop = true;
+    }
+    videoFrameSignal.notify_all();
+
+    if (videoDecodeThread.joinable())
+        videoDecodeThread.join();
+}
+
+// stops the decoder & frees everything the last video was using, playback can be abandoned (e.g. by changing scene from the dev menu) without
+// ProcessVideo ever getting to finish it, so this happens before a new one is loaded too
+void CloseVideoDecoder()
+{
+    StopVideoDecoding();
+    CloseFile(&VideoManager::file);
+
+    if (VideoManager::td) {
+        // Flush everything out
+        while (ogg_sync_pageout(&VideoManager::oy, &VideoManager::og) > 0) ogg_stream_pagein(&VideoManager::to, &VideoManager::og);
+
+        ogg_stream_clear(&VideoManager::to);
+        th_decode_free(VideoManager::td);
+        th_comment_clear(&VideoManager::tc);
+        th_info_clear(&VideoManager::ti);
+        ogg_sync_clear(&VideoManager::oy);
+        VideoManager::td = NULL;
+    }
+}
+
+void UploadVideoFrame(VideoFrame *frame)
+{
+    uint8 *y = frame->planes[0].data();
+    uint8 *u = frame->planes[1].data();
+    uint8 *v = frame->planes[2].data();
+
+    int32 dataPos = (VideoManager::ti.pic_x & 0xFFFFFFFE) + (VideoManager::ti.pic_y & 0xFFFFFFFE) * frame->stride[0];
+    switch (VideoManager::pixelFormat) {
+        default: break;
+
+        case TH_PF_444:
+            RenderDevice::SetupVideoTexture_YUV444(frame->width[0], frame->height[0], &y[dataPos], &u[dataPos], &v[dataPos], frame->stride[0],
+                                                   frame->stride[1], frame->stride[2]);
+            break;
+
+        case TH_PF_422:
+            RenderDevice::SetupVideoTexture_YUV422(frame->width[0], frame->height[0], &y[dataPos],
+                                                   &u[frame->stride[1] * VideoManager::ti.pic_y + (VideoManager::ti.pic_x >> 1)],
+                                                   &v[frame->stride[1] * VideoManager::ti.pic_y + (VideoManager::ti.pic_x >> 1)], frame->stride[0],
+                                                   frame->stride[1], frame->stride[2]);
+            break;
+
+        case TH_PF_420:
+            RenderDevice::SetupVideoTexture_YUV420(frame->width[0], frame->height[0], &y[dataPos],
+                                                   &u[frame->stride[1] * (VideoManager::ti.pic_y >> 1) + (VideoManager::ti.pic_x >> 1)],
+                                                   &v[frame->stride[1] * (VideoManager::ti.pic_y >> 1) + (VideoManager::ti.pic_x >> 1)],
+                                                   frame->stride[0], frame->stride[1], frame->stride[2]);
+            break;
+    }
+}
+
 bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCallback)())
 {
     if (ENGINE_VERSION == 5 && sceneInfo.state == ENGINESTATE_VIDEOPLAYBACK)
@@ -27,6 +181,8 @@ bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCal
         return false;
 #endif
 
+    CloseVideoDecoder();
+
     char fullFilePath[0x80];
     sprintf_s(fullFilePath, sizeof(fullFilePath), "Data/Video/%s", filename);
 
@@ -46,7 +202,7 @@ bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCal
         while (!finishedHeader) {
             buffer    = ogg_sync_buffer(&VideoManager::oy, 0x1000);
             int32 ret = (int32)ReadBytes(&VideoManager::file, buffer, 0x1000);
-            ogg_sync_wrote(&VideoManager::oy, 0x1000);
+            ogg_sync_wrote(&VideoManager::oy, ret);
 
             if (ret == 0)
                 break;
@@ -119,7 +275,7 @@ bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCal
                 else {
                     buffer    = ogg_sync_buffer(&VideoManager::oy, 0x1000);
                     int32 ret = (int32)ReadBytes(&VideoManager::file, buffer, 0x1000);
-                    ogg_sync_wrote(&VideoManager::oy, 0x1000);
+                    ogg_sync_wrote(&VideoManager::oy, ret);
                     if (ret == 0) {
 #if !RETRO_USE_ORIGINAL_CODE
                         PrintLog(PRINT_NORMAL, "ERROR: Reached end of file while searching for codec headers.");
@@ -171,6 +327,13 @@ bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCal
                     case TH_PF_444: videoSettings.shaderID = SHADER_YUV_444; break;
                 }
 
+                videoFrameHead      = 0;
+                videoFrameCount     = 0;
+                videoFrameEndTime   = 0.0;
+                videoDecodeFinished = false;
+                videoDecodeStop     = false;
+                videoDecodeThread   = std::thread(VideoDecodeLoop);
+
                 engine.skipCallback = NULL;
                 ProcessVideo();
                 engine.skipCallback = skipCallback;
@@ -196,7 +359,6 @@ bool32 RSDK::LoadVideo(const char *filename, double startDelay, bool32 (*skipCal
 void RSDK::ProcessVideo()
 {
     bool32 finished = false;
-    double curTime  = 0;
     if (!VideoManager::initializing) {
         double streamPos = GetVideoStreamPos();
 
@@ -205,8 +367,6 @@ void RSDK::ProcessVideo()
         else
             engine.displayTime = streamPos;
 
-        curTime = th_granule_time(VideoManager::td, VideoManager::granulePos);
-
 #if RETRO_USE_MOD_LOADER
         RunModCallbacks(MODCB_ONVIDEOSKIPCB, (void *)engine.skipCallback);
 #endif
@@ -215,64 +375,45 @@ void RSDK::ProcessVideo()
         }
     }
 
-    if (!finished && (VideoManager::initializing || engine.displayTime >= engine.videoStartDelay + curTime)) {
-        while (ogg_stream_packetout(&VideoManager::to, &VideoManager::op) <= 0) {
-            char *buffer = ogg_sync_buffer(&VideoManager::oy, 0x1000);
-            // if we're playing and reached the end of file
-            if (!ReadBytes(&VideoManager::file, buffer, 0x1000) && !VideoManager::initializing) {
-                finished = true;
-                break;
-            }
-
-            ogg_sync_wrote(&VideoManager::oy, 0x1000);
-
-            while (ogg_sync_pageout(&VideoManager::oy, &VideoManager::og) > 0) ogg_stream_pagein(&VideoManager::to, &VideoManager::og);
-        }
+    if (!finished && (VideoManager::initializing || engine.displayTime >= engine.videoStartDelay + videoFrameEndTime)) {
+        double videoTime  = engine.displayTime - engine.videoStartDelay;
+        VideoFrame *frame = NULL;
+        {
+            std::unique_lock<std::mutex> lock(videoFrameMutex);
 
-        if (!finished && !th_decode_packetin(VideoManager::td, &VideoManager::op, &VideoManager::granulePos)) {
-            th_ycbcr_buffer yuv;
-            th_decode_ycbcr_out(VideoManager::td, yuv);
+            // the first frame has to be there before playback starts, after that we never wait on the decoder
+            if (VideoManager::initializing)
+                videoFrameSignal.wait(lock, [] { return videoFrameCount || videoDecodeFinished; });
 
-            int32 dataPos = (VideoManager::ti.pic_x & 0xFFFFFFFE) + (VideoManager::ti.pic_y & 0xFFFFFFFE) * yuv[0].stride;
-            switch (VideoManager::pixelFormat) {
-                default: break;
+            // drop any frames that have already been & gone, but always keep the newest one around to show
+            while (videoFrameCount > 1 && videoFrames[videoFrameHead].endTime <= videoTime) {
+                videoFrameHead = (videoFrameHead + 1) % VIDEO_FRAME_QUEUE_SIZE;
+                --videoFrameCount;
+            }
+            videoFrameSignal.notify_all();
 
-                case TH_PF_444:
-                    RenderDevice::SetupVideoTexture_YUV444(yuv[0].width, yuv[0].height, &yuv[0].data[dataPos], &yuv[1].data[dataPos],
-                                                           &yuv[2].data[dataPos], yuv[0].stride, yuv[1].stride, yuv[2].stride);
-                    break;
+            if (videoFrameCount)
+                frame = &videoFrames[videoFrameHead];
+            else if (videoDecodeFinished && !VideoManager::initializing)
+                finished = true;
+        }
 
-                case TH_PF_422:
-                    RenderDevice::SetupVideoTexture_YUV422(yuv[0].width, yuv[0].height, &yuv[0].data[dataPos],
-                                                           &yuv[1].data[yuv[1].stride * VideoManager::ti.pic_y + (VideoManager::ti.pic_x >> 1)],
-                                                           &yuv[2].data[yuv[1].stride * VideoManager::ti.pic_y + (VideoManager::ti.pic_x >> 1)],
-                                                           yuv[0].stride, yuv[1].stride, yuv[2].stride);
-                    break;
+        if (frame) {
+            // the decoder won't touch this slot until it's been popped, so it's safe to read from without the lock
+            UploadVideoFrame(frame);
+            videoFrameEndTime = frame->endTime;
 
-                case TH_PF_420:
-                    RenderDevice::SetupVideoTexture_YUV420(
-                        yuv[0].width, yuv[0].height, &yuv[0].data[dataPos],
-                        &yuv[1].data[yuv[1].stride * (VideoManager::ti.pic_y >> 1) + (VideoManager::ti.pic_x >> 1)],
-                        &yuv[2].data[yuv[1].stride * (VideoManager::ti.pic_y >> 1) + (VideoManager::ti.pic_x >> 1)], yuv[0].stride, yuv[1].stride,
-                        yuv[2].stride);
-                    break;
-            }
+            std::lock_guard<std::mutex> lock(videoFrameMutex);
+            videoFrameHead = (videoFrameHead + 1) % VIDEO_FRAME_QUEUE_SIZE;
+            --videoFrameCount;
+            videoFrameSignal.notify_all();
         }
 
         VideoManager::initializing = false;
     }
 
     if (finished) {
-        CloseFile(&VideoManager::file);
-
-        // Flush everything out
-        while (ogg_sync_pageout(&VideoManager::oy, &VideoManager::og) > 0) ogg_stream_pagein(&VideoManager::to, &VideoManager::og);
-
-        ogg_stream_clear(&VideoManager::to);
-        th_decode_free(VideoManager::td);
-        th_comment_clear(&VideoManager::tc);
-        th_info_clear(&VideoManager::ti);
-        ogg_sync_clear(&VideoManager::oy);
+        CloseVideoDecoder();
 
         videoSettings.shaderID    = engine.storedShaderID;
         videoSettings.screenCount = 1;
@@ -284,3 +425,5 @@ void RSDK::ProcessVideo()
 #endif
     }
 }
+
+void RSDK::ReleaseVideo() { CloseVideoDecoder(); }
@@ -24,6 +24,8 @@ struct VideoManager {
 
 bool32 LoadVideo(const char *filename, double startDelay, bool32 (*skipCallback)());
 void ProcessVideo();
+// stops the decoder thread if a video is still playing
+void ReleaseVideo();
 
 } // namespace RSDK
 
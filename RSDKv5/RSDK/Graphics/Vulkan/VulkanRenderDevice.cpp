@@ -835,6 +835,7 @@ bool RenderDevice::InitGraphicsAPI()
     }
 
     //! TEXTURE CREATION
+    ResetFrameBufferBands();
     for (int32 i = 0; i < SCREEN_COUNT; ++i) {
         VkImageCreateInfo imageInfo{};
         imageInfo.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -1332,37 +1333,41 @@ void RenderDevice::UpdateFPSCap() { lastFrame = glfwGetTime(); }
 void RenderDevice::CopyFrameBuffer()
 {
     for (int32 s = 0; s < videoSettings.screenCount; ++s) {
-        uint16 *pixels      = (uint16 *)screenTextures[s].map;
-        uint16 *frameBuffer = screens[s].frameBuffer;
+        uint32 bands = GetFrameBufferUploadBands(s);
 
         int32 screenPitch = screens[s].pitch;
         int32 pitch       = (screenTextures[s].layout.rowPitch >> 1) - screenPitch;
 
-        for (int32 y = 0; y < SCREEN_YSIZE; ++y) {
-            int32 pixelCount = screenPitch >> 4;
-            for (int32 x = 0; x < pixelCount; ++x) {
-                pixels[0]  = frameBuffer[0];
-                pixels[1]  = frameBuffer[1];
-                pixels[2]  = frameBuffer[2];
-                pixels[3]  = frameBuffer[3];
-                pixels[4]  = frameBuffer[4];
-                pixels[5]  = frameBuffer[5];
-                pixels[6]  = frameBuffer[6];
-                pixels[7]  = frameBuffer[7];
-                pixels[8]  = frameBuffer[8];
-                pixels[9]  = frameBuffer[9];
-                pixels[10] = frameBuffer[10];
-                pixels[11] = frameBuffer[11];
-                pixels[12] = frameBuffer[12];
-                pixels[13] = frameBuffer[13];
-                pixels[14] = frameBuffer[14];
-                pixels[15] = frameBuffer[15];
-
-                frameBuffer += 16;
-                pixels += 16;
+        for (int32 y = 0, h = 0; GetNextFrameBufferUpload(bands, &y, &h); y += h) {
+            uint16 *pixels      = (uint16 *)screenTextures[s].map + y * (screenTextures[s].layout.rowPitch >> 1);
+            uint16 *frameBuffer = &screens[s].frameBuffer[y * screenPitch];
+
+            for (int32 r = 0; r < h; ++r) {
+                int32 pixelCount = screenPitch >> 4;
+                for (int32 x = 0; x < pixelCount; ++x) {
+                    pixels[0]  = frameBuffer[0];
+                    pixels[1]  = frameBuffer[1];
+                    pixels[2]  = frameBuffer[2];
+                    pixels[3]  = frameBuffer[3];
+                    pixels[4]  = frameBuffer[4];
+                    pixels[5]  = frameBuffer[5];
+                    pixels[6]  = frameBuffer[6];
+                    pixels[7]  = frameBuffer[7];
+                    pixels[8]  = frameBuffer[8];
+                    pixels[9]  = frameBuffer[9];
+                    pixels[10] = frameBuffer[10];
+                    pixels[11] = frameBuffer[11];
+                    pixels[12] = frameBuffer[12];
+                    pixels[13] = frameBuffer[13];
+                    pixels[14] = frameBuffer[14];
+                    pixels[15] = frameBuffer[15];
+
+                    frameBuffer += 16;
+                    pixels += 16;
+                }
+
+                pixels += pitch;
             }
-
-            pixels += pitch;
         }
     }
 }
@@ -52,6 +52,8 @@ int32 RSDK::gamePadCount               = 0;
 #include "Paddleboat/PDBInputDevice.cpp"
 #endif
 
+#include "Replay/ReplayInputDevice.cpp"
+
 void RSDK::RemoveInputDevice(InputDevice *targetDevice)
 {
     if (targetDevice) {
@@ -100,6 +102,12 @@ void RSDK::InitInputDevices()
     for (int32 i = 0; i < PLAYER_COUNT; ++i) inputSlots[i] = INPUT_AUTOASSIGN;
 #endif
 
+    // the replay devices stand in for every live one, so nothing pressed during playback can leak into the run
+    if (SKU::inputReplayMode == SKU::INPUTREPLAY_PLAYBACK) {
+        SKU::InitReplayInputAPI();
+        return;
+    }
+
 #if RETRO_INPUTDEVICE_KEYBOARD
     SKU::InitKeyboardInputAPI();
 #endif
@@ -138,6 +146,8 @@ void RSDK::ReleaseInputDevices()
 #if RETRO_INPUTDEVICE_SDL2
     SKU::ReleaseSDL2InputAPI();
 #endif
+
+    SKU::ReleaseReplayInputAPI();
 }
 
 void RSDK::ClearInput()
@@ -195,6 +205,10 @@ void RSDK::ProcessInput()
 {
     ClearInput();
 
+    bool32 replaying = SKU::inputReplayMode == SKU::INPUTREPLAY_PLAYBACK;
+    if (replaying)
+        SKU::ReadInputFrame();
+
     bool32 anyPress = false;
     for (int32 i = 0; i < inputDeviceCount; ++i) {
         if (inputDeviceList[i]) {
@@ -204,6 +218,11 @@ void RSDK::ProcessInput()
         }
     }
 
+    if (replaying) {
+        anyPress = SKU::inputReplayFrame.anyPress;
+        SKU::AssignReplaySlots();
+    }
+
 #if RETRO_REV02
     if (anyPress || touchInfo.count)
         videoSettings.dimTimer = 0;
@@ -229,9 +248,15 @@ void RSDK::ProcessInput()
     }
 
 #if !RETRO_REV02 && RETRO_INPUTDEVICE_KEYBOARD
-    RSDK::SKU::HandleSpecialKeys();
+    // the recorded frame already has these set
+    if (!replaying)
+        RSDK::SKU::HandleSpecialKeys();
 #endif
 
+    // record everything the devices wrote before it gets resolved into down/press states below
+    if (SKU::inputReplayMode == SKU::INPUTREPLAY_RECORD)
+        SKU::RecordInputFrame(anyPress);
+
     for (int32 c = 0; c <= PLAYER_COUNT; ++c) {
         if (c <= 0 || inputSlots[c - 1] != INPUT_UNASSIGNED) {
             InputState *cont[] = {
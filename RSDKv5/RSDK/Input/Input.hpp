@@ -58,8 +58,9 @@ enum InputDeviceAPIs {
     DEVICE_API_GLFW, // custom-made for OGL, won't be in ANY real RSDKv5 version ever, it's just cool
 #endif
 #if RETRO_INPUTDEVICE_PDBOAT
-    DEVICE_API_PDBOAT // custom-made for android (paddleboat API)
+    DEVICE_API_PDBOAT, // custom-made for android (paddleboat API)
 #endif
+    DEVICE_API_REPLAY, // custom-made for playing back input recordings, see Replay/ReplayInputDevice.hpp
 };
 
 enum ControllerKeys {
@@ -504,6 +505,8 @@ extern int32 gamePadCount;
 #include "Paddleboat/PDBInputDevice.hpp"
 #endif
 
+#include "Replay/ReplayInputDevice.hpp"
+
 // Initializes the input devices & the backend APIs powering em
 void InitInputDevices();
 // clears the input states, used by ProcessInput()
@@ -0,0 +1,338 @@
+#include <chrono>
+
+using namespace RSDK;
+
+int32 RSDK::SKU::inputReplayMode = INPUTREPLAY_NONE;
+char RSDK::SKU::inputReplayPath[0x100];
+uint32 RSDK::SKU::inputReplaySeed = 0;
+RSDK::SKU::InputReplayFrame RSDK::SKU::inputReplayFrame;
+int32 RSDK::SKU::inputReplayFrameCount = 0;
+
+FileIO *inputReplayFile = NULL;
+uint32 replayDeviceIDs[PLAYER_COUNT];
+std::chrono::high_resolution_clock::time_point replayStartTime;
+
+const int32 replayFrameWordCount = sizeof(RSDK::SKU::InputReplayFrame) / sizeof(uint32);
+
+#if !RETRO_REV02
+bool32 *replayTouchFlags[] = { &touchInfo.pauseHold,  &touchInfo.pausePress,  &touchInfo.unknown1,
+                               &touchInfo.anyKeyHold, &touchInfo.anyKeyPress, &touchInfo.unknown2 };
+#endif
+
+// the buttons are listed in ControllerKeys order first, so KEY_A, KEY_START, etc double as their bit in the button masks
+void GetReplayInputStates(int32 c, InputState **states, float **analog)
+{
+    InputState *buttons[] = {
+        &controller[c].keyUp, &controller[c].keyDown, &controller[c].keyLeft,  &controller[c].keyRight,
+        &controller[c].keyA,  &controller[c].keyB,    &controller[c].keyC,     &controller[c].keyX,
+        &controller[c].keyY,  &controller[c].keyZ,    &controller[c].keyStart, &controller[c].keySelect,
+#if RETRO_REV02
+        &stickL[c].keyUp, &stickL[c].keyDown, &stickL[c].keyLeft, &stickL[c].keyRight, &stickL[c].keyStick,
+        &stickR[c].keyUp, &stickR[c].keyDown, &stickR[c].keyLeft, &stickR[c].keyRight, &stickR[c].keyStick,
+        &triggerL[c].keyBumper, &triggerL[c].keyTrigger, &triggerR[c].keyBumper, &triggerR[c].keyTrigger,
+#else
+        &stickL[c].keyUp, &stickL[c].keyDown, &stickL[c].keyLeft, &stickL[c].keyRight, &controller[c].keyStickL,
+        NULL, NULL, NULL, NULL, &controller[c].keyStickR,
+        &controller[c].keyBumperL, &controller[c].keyTriggerL, &controller[c].keyBumperR, &controller[c].keyTriggerR,
+#endif
+    };
+
+    float *deltas[] = {
+#if RETRO_REV02
+        &stickL[c].hDelta,        &stickL[c].vDelta,         &stickR[c].hDelta,        &stickR[c].vDelta,
+        &triggerL[c].bumperDelta, &triggerL[c].triggerDelta, &triggerR[c].bumperDelta, &triggerR[c].triggerDelta,
+#else
+        &stickL[c].hDeltaL,       &stickL[c].vDeltaL,        &stickL[c].hDeltaR,       &stickL[c].vDeltaR,
+        &stickL[c].triggerDeltaL, &stickL[c].triggerDeltaR,  NULL,                     NULL,
+#endif
+    };
+
+    memcpy(states, buttons, sizeof(buttons));
+    memcpy(analog, deltas, sizeof(deltas));
+}
+
+void CaptureReplayInputState(RSDK::SKU::InputReplayFrame *frame, int32 c)
+{
+    InputState *states[REPLAY_BUTTON_COUNT];
+    float *analog[REPLAY_ANALOG_COUNT];
+    GetReplayInputStates(c, states, analog);
+
+    for (int32 b = 0; b < REPLAY_BUTTON_COUNT; ++b) {
+        if (states[b] && states[b]->press)
+            frame->buttonMasks[c] |= 1 << b;
+    }
+
+    for (int32 a = 0; a < REPLAY_ANALOG_COUNT; ++a) frame->analog[c][a] = analog[a] ? *analog[a] : 0.0f;
+}
+
+void ApplyReplayInputState(int32 c)
+{
+    InputState *states[REPLAY_BUTTON_COUNT];
+    float *analog[REPLAY_ANALOG_COUNT];
+    GetReplayInputStates(c, states, analog);
+
+    for (int32 b = 0; b < REPLAY_BUTTON_COUNT; ++b) {
+        if (states[b])
+            states[b]->press = (RSDK::SKU::inputReplayFrame.buttonMasks[c] >> b) & 1;
+    }
+
+    for (int32 a = 0; a < REPLAY_ANALOG_COUNT; ++a) {
+        if (analog[a])
+            *analog[a] = RSDK::SKU::inputReplayFrame.analog[c][a];
+    }
+}
+
+void RSDK::SKU::InitInputReplay()
+{
+    uint32 signature = RSDK_SIGNATURE_RPL;
+    uint32 frameSize = sizeof(InputReplayFrame);
+
+    switch (inputReplayMode) {
+        default: break;
+
+        case INPUTREPLAY_RECORD:
+            inputReplayFile = fOpen(inputReplayPath, "wb");
+            if (inputReplayFile) {
+                inputReplaySeed = (uint32)time(NULL);
+
+                fWrite(&signature, sizeof(uint32), 1, inputReplayFile);
+                fWrite(&frameSize, sizeof(uint32), 1, inputReplayFile);
+                fWrite(&inputReplaySeed, sizeof(uint32), 1, inputReplayFile);
+            }
+            break;
+
+        case INPUTREPLAY_PLAYBACK:
+            inputReplayFile = fOpen(inputReplayPath, "rb");
+            if (inputReplayFile) {
+                signature = 0;
+                frameSize = 0;
+                fRead(&signature, sizeof(uint32), 1, inputReplayFile);
+                fRead(&frameSize, sizeof(uint32), 1, inputReplayFile);
+                fRead(&inputReplaySeed, sizeof(uint32), 1, inputReplayFile);
+
+                // the frame layout differs between revisions, so recordings only play back on the same kind of build that made them
+                if (signature != RSDK_SIGNATURE_RPL || frameSize != sizeof(InputReplayFrame)) {
+                    fClose(inputReplayFile);
+                    inputReplayFile = NULL;
+                }
+            }
+            break;
+    }
+
+    if (inputReplayMode != INPUTREPLAY_NONE) {
+        if (inputReplayFile) {
+            PrintLog(PRINT_NORMAL, "InputReplay: %s %s", inputReplayMode == INPUTREPLAY_RECORD ? "recording to" : "playing back", inputReplayPath);
+        }
+        else {
+            PrintLog(PRINT_NORMAL, "InputReplay: couldn't open %s", inputReplayPath);
+            inputReplayMode = INPUTREPLAY_NONE;
+        }
+    }
+
+    memset(&inputReplayFrame, 0, sizeof(inputReplayFrame));
+    inputReplayFrameCount = 0;
+}
+
+RSDK::SKU::InputDeviceReplay *RSDK::SKU::InitReplayDevice(uint32 id)
+{
+    if (inputDeviceCount == INPUTDEVICE_COUNT)
+        return NULL;
+
+    if (inputDeviceList[inputDeviceCount] && inputDeviceList[inputDeviceCount]->active)
+        return NULL;
+
+    if (inputDeviceList[inputDeviceCount])
+        delete inputDeviceList[inputDeviceCount];
+
+    inputDeviceList[inputDeviceCount] = new InputDeviceReplay();
+
+    InputDeviceReplay *device = (InputDeviceReplay *)inputDeviceList[inputDeviceCount];
+    device->gamepadType       = (DEVICE_API_REPLAY << 16) | (DEVICE_TYPE_CONTROLLER << 8) | (DEVICE_XBOX << 0);
+    device->disabled          = false;
+    device->id                = id;
+    device->active            = true;
+
+    for (int32 i = 0; i < PLAYER_COUNT; ++i) {
+        if ((uint32)inputSlots[i] == id) {
+            inputSlotDevices[i] = device;
+            device->isAssigned  = true;
+        }
+    }
+
+    inputDeviceCount++;
+    return device;
+}
+
+void RSDK::SKU::InitReplayInputAPI()
+{
+    char idBuffer[0x10];
+    for (int32 i = 0; i < PLAYER_COUNT; ++i) {
+        sprintf_s(idBuffer, sizeof(idBuffer), "ReplayDevice%d", i);
+        uint32 id = 0;
+        GenerateHashCRC(&id, idBuffer);
+
+        InputDeviceReplay *device = InitReplayDevice(id);
+        if (device)
+            device->controllerID = i;
+
+        replayDeviceIDs[i] = id;
+    }
+}
+
+void RSDK::SKU::ReleaseReplayInputAPI()
+{
+    if (inputReplayFile) {
+        if (inputReplayMode == INPUTREPLAY_RECORD)
+            PrintLog(PRINT_NORMAL, "InputReplay: recorded %d frames to %s", inputReplayFrameCount, inputReplayPath);
+
+        fClose(inputReplayFile);
+        inputReplayFile = NULL;
+    }
+}
+
+void RSDK::SKU::InputDeviceReplay::UpdateInput()
+{
+    // every replay device follows CONT_ANY, so GetFilteredInputDeviceID() ties & picks the first one like it would with one player
+    this->prevButtonMasks = this->buttonMasks;
+    this->buttonMasks     = inputReplayFrame.buttonMasks[CONT_ANY];
+
+    uint32 changedKeys = ~this->prevButtonMasks & this->buttonMasks;
+    if (changedKeys)
+        this->inactiveTimer[0] = 0;
+    else
+        ++this->inactiveTimer[0];
+
+    if (changedKeys & ((1 << KEY_A) | (1 << KEY_START)))
+        this->inactiveTimer[1] = 0;
+    else
+        ++this->inactiveTimer[1];
+
+    // slots get assigned by AssignReplaySlots() instead
+    this->anyPress = false;
+}
+
+void RSDK::SKU::InputDeviceReplay::ProcessInput(int32 controllerID) { ApplyReplayInputState(controllerID); }
+
+void RSDK::SKU::RecordInputFrame(bool32 anyPress)
+{
+    if (!inputReplayFile)
+        return;
+
+    InputReplayFrame frame;
+    memset(&frame, 0, sizeof(frame));
+
+    for (int32 c = 0; c <= PLAYER_COUNT; ++c) CaptureReplayInputState(&frame, c);
+
+    for (int32 t = 0; t < 0x10; ++t) {
+        frame.touchX[t] = touchInfo.x[t];
+        frame.touchY[t] = touchInfo.y[t];
+        if (touchInfo.down[t])
+            frame.touchDown |= 1 << t;
+    }
+    frame.touchCount = touchInfo.count;
+
+#if !RETRO_REV02
+    for (int32 f = 0; f < 6; ++f) {
+        if (*replayTouchFlags[f])
+            frame.touchFlags |= 1 << f;
+    }
+#endif
+
+    for (int32 i = 0; i < PLAYER_COUNT; ++i) {
+        if (inputSlots[i] != INPUT_NONE && inputSlots[i] != INPUT_AUTOASSIGN && inputSlots[i] != INPUT_UNASSIGNED)
+            frame.slotMask |= 1 << i;
+    }
+    frame.anyPress = anyPress ? 1 : 0;
+
+    // a frame is a span count followed by (words skipped, word count, words) for each run of words that changed since the last frame
+    // so a frame where nothing changed only costs a single byte
+    const uint32 *words     = (const uint32 *)&frame;
+    const uint32 *prevWords = (const uint32 *)&inputReplayFrame;
+
+    uint8 buffer[1 + replayFrameWordCount * (2 + sizeof(uint32))];
+    int32 size      = 1;
+    int32 spanCount = 0;
+    int32 spanEnd   = 0;
+    for (int32 w = 0; w < replayFrameWordCount;) {
+        if (words[w] == prevWords[w]) {
+            ++w;
+            continue;
+        }
+
+        int32 start = w;
+        while (w < replayFrameWordCount && words[w] != prevWords[w]) ++w;
+
+        buffer[size++] = start - spanEnd;
+        buffer[size++] = w - start;
+        memcpy(&buffer[size], &words[start], (w - start) * sizeof(uint32));
+        size += (w - start) * sizeof(uint32);
+
+        spanEnd = w;
+        ++spanCount;
+    }
+    buffer[0] = spanCount;
+
+    fWrite(buffer, 1, size, inputReplayFile);
+
+    memcpy(&inputReplayFrame, &frame, sizeof(frame));
+    ++inputReplayFrameCount;
+}
+
+void RSDK::SKU::ReadInputFrame()
+{
+    if (inputReplayFile) {
+        uint32 *words = (uint32 *)&inputReplayFrame;
+
+        uint8 spanCount = 0;
+        bool32 valid    = fRead(&spanCount, 1, 1, inputReplayFile) == 1;
+        if (valid && !inputReplayFrameCount)
+            replayStartTime = std::chrono::high_resolution_clock::now();
+
+        for (int32 s = 0, w = 0; valid && s < spanCount; ++s) {
+            uint8 span[2];
+            valid = fRead(span, 1, 2, inputReplayFile) == 2;
+
+            w += span[0];
+            valid = valid && w + span[1] <= replayFrameWordCount;
+            valid = valid && fRead(&words[w], sizeof(uint32), span[1], inputReplayFile) == span[1];
+            w += span[1];
+        }
+
+        if (valid) {
+            ++inputReplayFrameCount;
+        }
+        else {
+            double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - replayStartTime).count();
+            PrintLog(PRINT_NORMAL, "InputReplay: played %d frames in %.2fs (%.2f fps)", inputReplayFrameCount, seconds,
+                     seconds > 0.0 ? inputReplayFrameCount / seconds : 0.0);
+
+            fClose(inputReplayFile);
+            inputReplayFile = NULL;
+
+            // run out the last frame with no input & then shut down
+            memset(&inputReplayFrame, 0, sizeof(inputReplayFrame));
+            RenderDevice::isRunning = false;
+        }
+    }
+
+    ApplyReplayInputState(CONT_ANY);
+
+    for (int32 t = 0; t < 0x10; ++t) {
+        touchInfo.x[t]    = inputReplayFrame.touchX[t];
+        touchInfo.y[t]    = inputReplayFrame.touchY[t];
+        touchInfo.down[t] = (inputReplayFrame.touchDown >> t) & 1;
+    }
+    touchInfo.count = inputReplayFrame.touchCount;
+
+#if !RETRO_REV02
+    for (int32 f = 0; f < 6; ++f) *replayTouchFlags[f] = (inputReplayFrame.touchFlags >> f) & 1;
+#endif
+}
+
+void RSDK::SKU::AssignReplaySlots()
+{
+    for (int32 i = 0; i < PLAYER_COUNT; ++i) {
+        if (((inputReplayFrame.slotMask >> i) & 1) && !InputDeviceFromID(inputSlots[i]))
+            AssignInputSlotToDevice(CONT_P1 + i, replayDeviceIDs[i]);
+    }
+}
@@ -0,0 +1,60 @@
+
+namespace SKU
+{
+
+#define RSDK_SIGNATURE_RPL (0x4C5052) // "RPL"
+
+// 12 controller buttons, 5 per stick & 2 per trigger/bumper pair
+#define REPLAY_BUTTON_COUNT (12 + 5 + 5 + 2 + 2)
+#define REPLAY_ANALOG_COUNT (8)
+
+enum InputReplayModes {
+    INPUTREPLAY_NONE,
+    INPUTREPLAY_RECORD,
+    INPUTREPLAY_PLAYBACK,
+};
+
+// the input state for a single ProcessInput() call
+// everything is a whole word so frames can be delta-encoded against the previous one a word at a time
+struct InputReplayFrame {
+    uint32 buttonMasks[PLAYER_COUNT + 1];
+    float analog[PLAYER_COUNT + 1][REPLAY_ANALOG_COUNT];
+    float touchX[0x10];
+    float touchY[0x10];
+    uint32 touchDown;
+    uint8 touchCount;
+    uint8 touchFlags; // rev01's pause/anyKey states
+    uint8 slotMask;   // which input slots had a device assigned
+    uint8 anyPress;
+};
+
+struct InputDeviceReplay : InputDevice {
+    void UpdateInput();
+    void ProcessInput(int32 controllerID);
+
+    uint8 controllerID;
+    uint32 buttonMasks;
+    uint32 prevButtonMasks;
+};
+
+extern int32 inputReplayMode;
+extern char inputReplayPath[0x100];
+extern uint32 inputReplaySeed;
+extern InputReplayFrame inputReplayFrame;
+extern int32 inputReplayFrameCount;
+
+// opens the file set via "inputrecord=<path>" or "inputreplay=<path>", this has to happen before the rand seed is set
+void InitInputReplay();
+// playback only: swaps every live device for one replay device per input slot
+void InitReplayInputAPI();
+InputDeviceReplay *InitReplayDevice(uint32 id);
+void ReleaseReplayInputAPI();
+
+// writes the state the live devices produced this frame, called by ProcessInput() right before the down/press states get resolved
+void RecordInputFrame(bool32 anyPress);
+// reads the next recorded frame & applies its CONT_ANY & touch state, the replay devices handle the input slots
+void ReadInputFrame();
+// matches the input slot assignments to the recording, since the replay devices never "press" anything to get auto-assigned
+void AssignReplaySlots();
+
+} // namespace SKU
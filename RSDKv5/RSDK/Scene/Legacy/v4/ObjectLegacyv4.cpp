@@ -5,11 +5,106 @@ int32 RSDK::Legacy::v4::curObjectType   = 0;
 RSDK::Legacy::v4::Entity RSDK::Legacy::v4::objectEntityList[LEGACY_v4_ENTITY_COUNT * 2]; //"regular" list & "storage" list
 int32 RSDK::Legacy::v4::processObjectFlag[LEGACY_v4_ENTITY_COUNT];
 RSDK::Legacy::v4::TypeGroupList RSDK::Legacy::v4::objectTypeGroupList[LEGACY_v4_TYPEGROUP_COUNT];
+RSDK::Legacy::v4::EntitySpatialIndex RSDK::Legacy::v4::entitySpatialIndex;
 
 int32 RSDK::Legacy::v4::playerListPos = 0;
 
 char RSDK::Legacy::v4::typeNames[LEGACY_v4_OBJECT_COUNT][0x40];
 
+inline int32 GetEntitySpatialColumn(RSDK::Legacy::v4::Entity *entity)
+{
+    using namespace RSDK::Legacy::v4;
+
+    switch (entity->priority) {
+        case PRIORITY_BOUNDS:
+        case PRIORITY_XBOUNDS:
+        case PRIORITY_BOUNDS_SMALL: return CLAMP((entity->xpos >> 16) >> LEGACY_v4_SPATIAL_COLUMN_SHIFT, 0, LEGACY_v4_SPATIAL_COLUMN_COUNT - 1);
+
+        case PRIORITY_ACTIVE:
+        case PRIORITY_ALWAYS:
+        case PRIORITY_ACTIVE_SMALL:
+        // these need to be checked every frame so they can be destroyed once they're out of bounds
+        case PRIORITY_XBOUNDS_DESTROY: return SPATIAL_COLUMN_ALWAYS;
+
+        default: return SPATIAL_COLUMN_NONE;
+    }
+}
+
+void RSDK::Legacy::v4::UpdateEntitySpatialIndex(int32 slot)
+{
+    if (slot < 0 || slot >= LEGACY_v4_ENTITY_COUNT)
+        return;
+
+    EntitySpatialIndex *index = &entitySpatialIndex;
+    int32 column              = GetEntitySpatialColumn(&objectEntityList[slot]);
+    int32 prevColumn          = index->slotColumns[slot];
+    if (column == prevColumn)
+        return;
+
+    uint32 bit = 1u << (slot & 31);
+    int32 word = slot >> 5;
+
+    if (prevColumn == SPATIAL_COLUMN_ALWAYS)
+        index->alwaysMask[word] &= ~bit;
+    else if (prevColumn >= 0)
+        index->columnMasks[prevColumn][word] &= ~bit;
+
+    if (column == SPATIAL_COLUMN_ALWAYS)
+        index->alwaysMask[word] |= bit;
+    else if (column >= 0)
+        index->columnMasks[column][word] |= bit;
+
+    index->slotColumns[slot] = column;
+
+    // if it moved into view mid-frame it still needs to be picked up (assuming we haven't passed its slot yet)
+    if (index->windowActive && (column == SPATIAL_COLUMN_ALWAYS || (column >= index->windowStart && column <= index->windowEnd)))
+        index->frameMask[word] |= bit;
+}
+
+void RebuildEntitySpatialIndex()
+{
+    using namespace RSDK::Legacy::v4;
+
+    EntitySpatialIndex *index = &entitySpatialIndex;
+    memset(index->columnMasks, 0, sizeof(index->columnMasks));
+    memset(index->alwaysMask, 0, sizeof(index->alwaysMask));
+    for (int32 i = 0; i < LEGACY_v4_ENTITY_COUNT; ++i) index->slotColumns[i] = SPATIAL_COLUMN_NONE;
+
+    index->windowActive = false;
+    for (int32 i = 0; i < LEGACY_v4_ENTITY_COUNT; ++i) UpdateEntitySpatialIndex(i);
+
+    index->valid = true;
+}
+
+// returns the first slot >= the given one that's being processed this frame, or LEGACY_v4_ENTITY_COUNT if there's none left
+int32 GetNextFrameSlot(int32 slot)
+{
+    using namespace RSDK::Legacy::v4;
+
+    if (slot < 0)
+        slot = 0;
+
+    int32 word = slot >> 5;
+    if (word >= LEGACY_v4_ENTITY_MASK_COUNT)
+        return LEGACY_v4_ENTITY_COUNT;
+
+    uint32 bits = entitySpatialIndex.frameMask[word] & (0xFFFFFFFF << (slot & 31));
+    while (!bits) {
+        if (++word >= LEGACY_v4_ENTITY_MASK_COUNT)
+            return LEGACY_v4_ENTITY_COUNT;
+
+        bits = entitySpatialIndex.frameMask[word];
+    }
+
+    slot = word << 5;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        ++slot;
+    }
+
+    return slot;
+}
+
 void RSDK::Legacy::v4::ProcessStartupObjects()
 {
     scriptFrameCount = 0;
@@ -46,7 +141,26 @@ void RSDK::Legacy::v4::ProcessObjects()
 {
     for (int32 i = 0; i < LEGACY_DRAWLAYER_COUNT; ++i) drawListEntries[i].listSize = 0;
 
-    for (objectEntityPos = 0; objectEntityPos < LEGACY_v4_ENTITY_COUNT; ++objectEntityPos) {
+    EntitySpatialIndex *index = &entitySpatialIndex;
+    if (!index->valid)
+        RebuildEntitySpatialIndex();
+
+    // only visit slots in columns overlapping the largest object bounds, along with the ones that always need checking
+    // the exact bounds checks are still done below, this just skips slots that can't possibly pass them
+    int32 boundsStart  = xScrollOffset - MAX(OBJECT_BORDER_X1, OBJECT_BORDER_X3);
+    int32 boundsEnd    = xScrollOffset + MAX(OBJECT_BORDER_X2, OBJECT_BORDER_X4);
+    index->windowStart = CLAMP(boundsStart >> LEGACY_v4_SPATIAL_COLUMN_SHIFT, 0, LEGACY_v4_SPATIAL_COLUMN_COUNT - 1);
+    index->windowEnd   = CLAMP(boundsEnd >> LEGACY_v4_SPATIAL_COLUMN_SHIFT, 0, LEGACY_v4_SPATIAL_COLUMN_COUNT - 1);
+
+    memcpy(index->frameMask, index->alwaysMask, sizeof(index->frameMask));
+    for (int32 c = index->windowStart; c <= index->windowEnd; ++c) {
+        for (int32 w = 0; w < LEGACY_v4_ENTITY_MASK_COUNT; ++w) index->frameMask[w] |= index->columnMasks[c][w];
+    }
+
+    memset(processObjectFlag, 0, sizeof(processObjectFlag));
+    index->windowActive = true;
+
+    for (objectEntityPos = GetNextFrameSlot(0); objectEntityPos < LEGACY_v4_ENTITY_COUNT; objectEntityPos = GetNextFrameSlot(objectEntityPos + 1)) {
         processObjectFlag[objectEntityPos] = false;
         int32 x = 0, y = 0;
         Entity *entity = &objectEntityList[objectEntityPos];
@@ -93,10 +207,12 @@ void RSDK::Legacy::v4::ProcessObjects()
                 drawListEntries[entity->drawOrder].entityRefs[drawListEntries[entity->drawOrder].listSize++] = objectEntityPos;
         }
     }
+    index->windowActive = false;
 
     for (int32 g = 0; g < LEGACY_v4_TYPEGROUP_COUNT; ++g) objectTypeGroupList[g].listSize = 0;
 
-    for (objectEntityPos = 0; objectEntityPos < LEGACY_v4_ENTITY_COUNT; ++objectEntityPos) {
+    // slots that weren't visited can't have their process flag set, so only the visited ones need checking
+    for (objectEntityPos = GetNextFrameSlot(0); objectEntityPos < LEGACY_v4_ENTITY_COUNT; objectEntityPos = GetNextFrameSlot(objectEntityPos + 1)) {
         Entity *entity = &objectEntityList[objectEntityPos];
         if (processObjectFlag[objectEntityPos] && entity->objectInteractions) {
             // Custom Group
@@ -9,6 +9,15 @@ namespace v4
 #define LEGACY_v4_OBJECT_COUNT     (0x100)
 #define LEGACY_v4_TYPEGROUP_COUNT  (0x103)
 
+#define LEGACY_v4_SPATIAL_COLUMN_SHIFT (7) // 128px wide columns
+#define LEGACY_v4_SPATIAL_COLUMN_COUNT (0x100)
+#define LEGACY_v4_ENTITY_MASK_COUNT    ((LEGACY_v4_ENTITY_COUNT + 31) / 32)
+
+enum SpatialColumnTypes {
+    SPATIAL_COLUMN_NONE   = -1, // never gets processed
+    SPATIAL_COLUMN_ALWAYS = -2, // gets checked every frame no matter where it is
+};
+
 enum ObjectControlModes {
     CONTROLMODE_NONE   = -1,
     CONTROLMODE_NORMAL = 0,
@@ -19,6 +28,19 @@ struct TypeGroupList {
     int32 listSize;
 };
 
+// entity slots binned by the column their x position is in, so ProcessObjects only has to visit slots near the screen
+// kept up to date by ProcessScript & any script functions that move or recreate entities
+struct EntitySpatialIndex {
+    uint32 columnMasks[LEGACY_v4_SPATIAL_COLUMN_COUNT][LEGACY_v4_ENTITY_MASK_COUNT];
+    uint32 alwaysMask[LEGACY_v4_ENTITY_MASK_COUNT];
+    uint32 frameMask[LEGACY_v4_ENTITY_MASK_COUNT]; // the slots ProcessObjects is visiting this frame
+    int16 slotColumns[LEGACY_v4_ENTITY_COUNT];
+    int32 windowStart;
+    int32 windowEnd;
+    bool32 windowActive;
+    bool32 valid;
+};
+
 struct Entity {
     int32 xpos;
     int32 ypos;
@@ -97,6 +119,7 @@ extern int32 curObjectType;
 extern Entity objectEntityList[LEGACY_v4_ENTITY_COUNT * 2];
 extern int32 processObjectFlag[LEGACY_v4_ENTITY_COUNT];
 extern TypeGroupList objectTypeGroupList[LEGACY_v4_TYPEGROUP_COUNT];
+extern EntitySpatialIndex entitySpatialIndex;
 
 extern char typeNames[LEGACY_v4_OBJECT_COUNT][0x40];
 
@@ -110,6 +133,11 @@ void Process2PObjects();
 
 void SetObjectTypeName(const char *objectName, int32 objectID);
 
+// forces the spatial index to be rebuilt from scratch next frame, call after bulk changes to objectEntityList
+inline void ResetEntitySpatialIndex() { entitySpatialIndex.valid = false; }
+// re-bins a slot after its position or priority may have changed
+void UpdateEntitySpatialIndex(int32 slot);
+
 void ProcessObjectControl(Entity *player);
 } // namespace v4
 
@@ -593,6 +593,7 @@ void RSDK::Legacy::v4::LoadStageFiles()
     for (int32 i = 0; i < LEGACY_TRACK_COUNT; ++i) SetMusicTrack("", i, false, 0);
 
     memset(objectEntityList, 0, LEGACY_v4_ENTITY_COUNT * sizeof(Entity));
+    ResetEntitySpatialIndex();
     for (int32 i = 0; i < LEGACY_v4_ENTITY_COUNT; ++i) {
         objectEntityList[i].drawOrder          = 3;
         objectEntityList[i].scale              = 512;
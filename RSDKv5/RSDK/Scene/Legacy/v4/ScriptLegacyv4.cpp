@@ -4706,6 +4706,7 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                 newEnt->objectInteractions = true;
                 newEnt->visible            = true;
                 newEnt->tileCollisions     = true;
+                UpdateEntitySpatialIndex(scriptEng.operands[0]);
                 break;
             }
             case FUNC_BOXCOLLISIONTEST:
@@ -4733,6 +4734,10 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                                           scriptEng.operands[7], scriptEng.operands[8], scriptEng.operands[9], scriptEng.operands[10]);
                         break;
                 }
+
+                // either entity could've been pushed
+                UpdateEntitySpatialIndex(scriptEng.operands[1]);
+                UpdateEntitySpatialIndex(scriptEng.operands[6]);
                 break;
             case FUNC_CREATETEMPOBJECT: {
                 opcodeSize = 0;
@@ -4753,6 +4758,7 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                 temp->objectInteractions = true;
                 temp->visible            = true;
                 temp->tileCollisions     = true;
+                UpdateEntitySpatialIndex(scriptEng.arrayPosition[8]);
                 break;
             }
             case FUNC_PROCESSOBJECTMOVEMENT:
@@ -5226,7 +5232,10 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
 
                 Entity *dstList = &objectEntityList[scriptEng.operands[0]];
                 Entity *srcList = &objectEntityList[scriptEng.operands[1]];
-                for (int32 i = 0; i < scriptEng.operands[2]; ++i) memcpy(&dstList[i], &srcList[i], sizeof(Entity));
+                for (int32 i = 0; i < scriptEng.operands[2]; ++i) {
+                    memcpy(&dstList[i], &srcList[i], sizeof(Entity));
+                    UpdateEntitySpatialIndex(scriptEng.operands[0] + i);
+                }
                 break;
             }
             case FUNC_PRINT: {
@@ -5449,6 +5458,7 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     }
                     case VAR_OBJECTXPOS: {
                         objectEntityList[arrayVal].xpos = scriptEng.operands[i];
+                        UpdateEntitySpatialIndex(arrayVal);
                         break;
                     }
                     case VAR_OBJECTYPOS: {
@@ -5457,6 +5467,7 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     }
                     case VAR_OBJECTIXPOS: {
                         objectEntityList[arrayVal].xpos = scriptEng.operands[i] << 16;
+                        UpdateEntitySpatialIndex(arrayVal);
                         break;
                     }
                     case VAR_OBJECTIYPOS: {
@@ -5489,6 +5500,7 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     }
                     case VAR_OBJECTPRIORITY: {
                         objectEntityList[arrayVal].priority = scriptEng.operands[i];
+                        UpdateEntitySpatialIndex(arrayVal);
                         break;
                     }
                     case VAR_OBJECTDRAWORDER: {
@@ -5900,7 +5912,11 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
                     case VAR_STAGEMIDPOINT: tLayerMidPoint = scriptEng.operands[i]; break;
                     case VAR_STAGEPLAYERLISTPOS: playerListPos = scriptEng.operands[i]; break;
                     case VAR_STAGEDEBUGMODE: debugMode = scriptEng.operands[i]; break;
-                    case VAR_STAGEENTITYPOS: objectEntityPos = scriptEng.operands[i]; break;
+                    case VAR_STAGEENTITYPOS:
+                        // anything done to the old slot since the script started needs to be picked up before we swap
+                        UpdateEntitySpatialIndex(objectEntityPos);
+                        objectEntityPos = scriptEng.operands[i];
+                        break;
                     case VAR_SCREENCAMERAENABLED: currentCamera->enabled = scriptEng.operands[i]; break;
                     case VAR_SCREENCAMERATARGET: currentCamera->target = scriptEng.operands[i]; break;
                     case VAR_SCREENCAMERASTYLE: currentCamera->style = scriptEng.operands[i]; break;
@@ -6040,4 +6056,7 @@ void RSDK::Legacy::v4::ProcessScript(int32 scriptCodeStart, int32 jumpTableStart
             }
         }
     }
+
+    // the entity running this script could've been moved by any number of functions, so make sure its index is up to date
+    UpdateEntitySpatialIndex(objectEntityPos);
 }
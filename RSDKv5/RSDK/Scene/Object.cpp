@@ -15,6 +15,11 @@ int32 RSDK::stageObjectIDs[OBJECT_COUNT];
 
 EntityBase RSDK::objectEntityList[ENTITY_COUNT];
 
+// the main update loop has to look at every slot, but the passes after it only need to visit entities it left in range,
+// anything written through the entity APIs since (copied/created entities can come out in range) & anything drawn last
+// frame (so onScreen can be cleared), so those get marked here & the later passes skip everything else
+uint32 RSDK::scheduledEntityMask[ENTITY_MASK_COUNT];
+
 EditableVarInfo *RSDK::editableVarList;
 int32 RSDK::editableVarCount = 0;
 
@@ -25,6 +30,11 @@ bool32 RSDK::validDraw = false;
 ForeachStackInfo RSDK::foreachStackList[FOREACH_STACK_COUNT];
 ForeachStackInfo *RSDK::foreachStackPtr = NULL;
 
+// bitmask of temp slots that are known to be free, objects usually destroy themselves by just clearing their classID
+// so this is only a hint, it gets rebuilt at the end of every frame (& whenever it runs dry) & any slot pulled from it is double checked before use
+#define TEMPENTITY_MASK_COUNT (TEMPENTITY_COUNT / 32)
+uint32 tempEntityFreeMask[TEMPENTITY_MASK_COUNT];
+
 #if RETRO_REV0U
 #if RETRO_USE_MOD_LOADER
 void RSDK::RegisterObject(Object **staticVars, const char *name, uint32 entityClassSize, uint32 staticClassSize, void (*update)(),
@@ -311,12 +321,105 @@ void RSDK::LoadStaticVariables(uint8 *classPtr, uint32 *hash, int32 readOffset)
     }
 }
 
+void RefreshTempEntitySlots()
+{
+    memset(tempEntityFreeMask, 0, sizeof(tempEntityFreeMask));
+    for (int32 i = 0; i < TEMPENTITY_COUNT; ++i) {
+        if (!objectEntityList[TEMPENTITY_START + i].classID)
+            tempEntityFreeMask[i >> 5] |= 1u << (i & 31);
+    }
+}
+
+inline void UpdateTempEntitySlot(Entity *entity)
+{
+    uint32 slot = (uint32)((EntityBase *)entity - objectEntityList) - TEMPENTITY_START;
+    if (slot < TEMPENTITY_COUNT) {
+        if (entity->classID)
+            tempEntityFreeMask[slot >> 5] &= ~(1u << (slot & 31));
+        else
+            tempEntityFreeMask[slot >> 5] |= 1u << (slot & 31);
+    }
+}
+
+// finds the next free temp slot after "slot" (wrapping around the temp range), or -1 if they're all in use
+int32 FindFreeTempEntitySlot(int32 slot)
+{
+    for (int32 attempt = 0; attempt < 2; ++attempt) {
+        int32 start = (slot + 1 - TEMPENTITY_START) % TEMPENTITY_COUNT;
+
+        for (int32 w = 0; w <= TEMPENTITY_MASK_COUNT; ++w) {
+            int32 word  = ((start >> 5) + w) % TEMPENTITY_MASK_COUNT;
+            uint32 bits = tempEntityFreeMask[word];
+
+            // the first word is checked twice, once for the bits after start & once more at the end for the bits before it
+            if (!w)
+                bits &= 0xFFFFFFFF << (start & 31);
+            else if (w == TEMPENTITY_MASK_COUNT)
+                bits &= ~(0xFFFFFFFF << (start & 31));
+
+            while (bits) {
+                int32 bit = 0;
+                while (!(bits & (1u << bit))) ++bit;
+
+                int32 id = (word << 5) + bit;
+                if (!objectEntityList[TEMPENTITY_START + id].classID)
+                    return TEMPENTITY_START + id;
+
+                // something else took it
+                tempEntityFreeMask[word] &= ~(1u << bit);
+                bits &= ~(1u << bit);
+            }
+        }
+
+        // slots might've been freed since the mask was last built, so rebuild it & give it one more go before giving up
+        if (!attempt)
+            RefreshTempEntitySlots();
+    }
+
+    return -1;
+}
+
+int32 GetNextScheduledEntity(int32 slot)
+{
+    int32 word = slot >> 5;
+    if (word >= ENTITY_MASK_COUNT)
+        return ENTITY_COUNT;
+
+    uint32 bits = scheduledEntityMask[word] & (0xFFFFFFFF << (slot & 31));
+    while (!bits) {
+        if (++word >= ENTITY_MASK_COUNT)
+            return ENTITY_COUNT;
+
+        bits = scheduledEntityMask[word];
+    }
+
+    slot = word << 5;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        ++slot;
+    }
+
+    return slot < ENTITY_COUNT ? slot : ENTITY_COUNT;
+}
+
+// leaves sceneInfo how a full sweep over the entity list would've & starts the mask over for the next frame
+inline void FinishScheduledEntities()
+{
+    sceneInfo.entitySlot = ENTITY_COUNT;
+    sceneInfo.entity     = &objectEntityList[ENTITY_COUNT - 1];
+
+    memset(scheduledEntityMask, 0, sizeof(scheduledEntityMask));
+}
+
 void RSDK::InitObjects()
 {
     sceneInfo.entitySlot = 0;
     sceneInfo.createSlot = ENTITY_COUNT - 0x100;
     cameraCount          = 0;
 
+    RefreshTempEntitySlots();
+    memset(scheduledEntityMask, 0, sizeof(scheduledEntityMask));
+
     for (int32 o = 0; o < sceneInfo.classCount; ++o) {
 #if RETRO_USE_MOD_LOADER
         currentObjectID = o;
@@ -453,6 +556,8 @@ void RSDK::ProcessObjects()
             }
 
             if (sceneInfo.entity->inRange) {
+                ScheduleEntity(sceneInfo.entity);
+
                 if (objectClassList[stageObjectIDs[sceneInfo.entity->classID]].update)
                     objectClassList[stageObjectIDs[sceneInfo.entity->classID]].update();
 
@@ -473,9 +578,9 @@ void RSDK::ProcessObjects()
 
     for (int32 i = 0; i < TYPEGROUP_COUNT; ++i) typeGroups[i].entryCount = 0;
 
-    sceneInfo.entitySlot = 0;
-    for (int32 e = 0; e < ENTITY_COUNT; ++e) {
-        sceneInfo.entity = &objectEntityList[e];
+    for (int32 e = GetNextScheduledEntity(0); e < ENTITY_COUNT; e = GetNextScheduledEntity(e + 1)) {
+        sceneInfo.entitySlot = e;
+        sceneInfo.entity     = &objectEntityList[e];
 
         if (sceneInfo.entity->inRange && sceneInfo.entity->interaction) {
             typeGroups[GROUP_ALL].entries[typeGroups[GROUP_ALL].entryCount++] = e; // All active objects
@@ -485,13 +590,11 @@ void RSDK::ProcessObjects()
             if (sceneInfo.entity->group >= TYPE_COUNT)
                 typeGroups[sceneInfo.entity->group].entries[typeGroups[sceneInfo.entity->group].entryCount++] = e; // extra groups
         }
-
-        sceneInfo.entitySlot++;
     }
 
-    sceneInfo.entitySlot = 0;
-    for (int32 e = 0; e < ENTITY_COUNT; ++e) {
-        sceneInfo.entity = &objectEntityList[e];
+    for (int32 e = GetNextScheduledEntity(0); e < ENTITY_COUNT; e = GetNextScheduledEntity(e + 1)) {
+        sceneInfo.entitySlot = e;
+        sceneInfo.entity     = &objectEntityList[e];
 
         if (sceneInfo.entity->inRange) {
             if (objectClassList[stageObjectIDs[sceneInfo.entity->classID]].lateUpdate)
@@ -499,12 +602,15 @@ void RSDK::ProcessObjects()
         }
 
         sceneInfo.entity->onScreen = 0;
-        sceneInfo.entitySlot++;
     }
 
+    FinishScheduledEntities();
+
 #if RETRO_USE_MOD_LOADER
     RunModCallbacks(MODCB_ONLATEUPDATE, INT_TO_VOID(ENGINESTATE_REGULAR));
 #endif
+
+    RefreshTempEntitySlots();
 }
 void RSDK::ProcessPausedObjects()
 {
@@ -530,6 +636,11 @@ void RSDK::ProcessPausedObjects()
     for (int32 e = 0; e < ENTITY_COUNT; ++e) {
         sceneInfo.entity = &objectEntityList[e];
 
+        // active is checked again before the late update, & a later entity's update is free to flip it on an earlier one,
+        // so every slot with an object in it gets visited rather than just the ones that are active right now
+        if (sceneInfo.entity->classID || sceneInfo.entity->active == ACTIVE_ALWAYS || sceneInfo.entity->active == ACTIVE_PAUSED)
+            ScheduleEntity(sceneInfo.entity);
+
         if (sceneInfo.entity->classID) {
             if (sceneInfo.entity->active == ACTIVE_ALWAYS || sceneInfo.entity->active == ACTIVE_PAUSED) {
                 if (objectClassList[stageObjectIDs[sceneInfo.entity->classID]].update)
@@ -550,9 +661,9 @@ void RSDK::ProcessPausedObjects()
     RunModCallbacks(MODCB_ONUPDATE, INT_TO_VOID(ENGINESTATE_PAUSED));
 #endif
 
-    sceneInfo.entitySlot = 0;
-    for (int32 e = 0; e < ENTITY_COUNT; ++e) {
-        sceneInfo.entity = &objectEntityList[e];
+    for (int32 e = GetNextScheduledEntity(0); e < ENTITY_COUNT; e = GetNextScheduledEntity(e + 1)) {
+        sceneInfo.entitySlot = e;
+        sceneInfo.entity     = &objectEntityList[e];
 
         if (sceneInfo.entity->active == ACTIVE_ALWAYS || sceneInfo.entity->active == ACTIVE_PAUSED) {
             if (objectClassList[stageObjectIDs[sceneInfo.entity->classID]].lateUpdate)
@@ -560,12 +671,15 @@ void RSDK::ProcessPausedObjects()
         }
 
         sceneInfo.entity->onScreen = 0;
-        sceneInfo.entitySlot++;
     }
 
+    FinishScheduledEntities();
+
 #if RETRO_USE_MOD_LOADER
     RunModCallbacks(MODCB_ONLATEUPDATE, INT_TO_VOID(ENGINESTATE_PAUSED));
 #endif
+
+    RefreshTempEntitySlots();
 }
 void RSDK::ProcessFrozenObjects()
 {
@@ -674,6 +788,8 @@ void RSDK::ProcessFrozenObjects()
             }
 
             if (sceneInfo.entity->inRange) {
+                ScheduleEntity(sceneInfo.entity);
+
                 if (sceneInfo.entity->active == ACTIVE_ALWAYS || sceneInfo.entity->active == ACTIVE_PAUSED) {
                     if (objectClassList[stageObjectIDs[sceneInfo.entity->classID]].update)
                         objectClassList[stageObjectIDs[sceneInfo.entity->classID]].update();
@@ -696,9 +812,9 @@ void RSDK::ProcessFrozenObjects()
 
     for (int32 i = 0; i < TYPEGROUP_COUNT; ++i) typeGroups[i].entryCount = 0;
 
-    sceneInfo.entitySlot = 0;
-    for (int32 e = 0; e < ENTITY_COUNT; ++e) {
-        sceneInfo.entity = &objectEntityList[e];
+    for (int32 e = GetNextScheduledEntity(0); e < ENTITY_COUNT; e = GetNextScheduledEntity(e + 1)) {
+        sceneInfo.entitySlot = e;
+        sceneInfo.entity     = &objectEntityList[e];
 
         if (sceneInfo.entity->inRange) {
             if (sceneInfo.entity->active == ACTIVE_ALWAYS || sceneInfo.entity->active == ACTIVE_PAUSED) {
@@ -717,12 +833,15 @@ void RSDK::ProcessFrozenObjects()
         }
 
         sceneInfo.entity->onScreen = 0;
-        sceneInfo.entitySlot++;
     }
 
+    FinishScheduledEntities();
+
 #if RETRO_USE_MOD_LOADER
     RunModCallbacks(MODCB_ONLATEUPDATE, INT_TO_VOID(ENGINESTATE_FROZEN));
 #endif
+
+    RefreshTempEntitySlots();
 }
 void RSDK::ProcessObjectDrawLists()
 {
@@ -730,6 +849,7 @@ void RSDK::ProcessObjectDrawLists()
         for (int32 s = 0; s < videoSettings.screenCount; ++s) {
             currentScreen             = &screens[s];
             sceneInfo.currentScreenID = s;
+            drawRecording             = engine.deferredDrawing;
 
             for (int32 l = 0; l < DRAWGROUP_COUNT; ++l) drawGroups[l].layerCount = 0;
 
@@ -775,9 +895,14 @@ void RSDK::ProcessObjectDrawLists()
 #endif
 
                             sceneInfo.entity->onScreen |= validDraw << sceneInfo.currentScreenID;
+                            if (validDraw)
+                                ScheduleEntity(sceneInfo.entity);
                         }
                     }
 
+                    // layers are drawn straight away, so anything recorded by the group's entities has to go first
+                    FlushDrawCommands();
+
                     for (int32 i = 0; i < list->layerCount; ++i) {
                         TileLayer *layer = &tileLayers[list->layerDrawList[i]];
 
@@ -1002,9 +1127,12 @@ void RSDK::ProcessObjectDrawLists()
 
 #endif
 
+            FlushDrawCommands();
             currentScreen++;
             sceneInfo.currentScreenID++;
         }
+
+        drawRecording = false;
     }
 }
 
@@ -1062,6 +1190,8 @@ void RSDK::ResetEntity(Entity *entity, uint16 classID, void *data)
         }
 
         entity->classID = classID;
+        UpdateTempEntitySlot(entity);
+        ScheduleEntity(entity);
     }
 }
 
@@ -1093,6 +1223,43 @@ void RSDK::ResetEntitySlot(uint16 slot, uint16 classID, void *data)
     else {
         entity->classID = classID;
     }
+
+    UpdateTempEntitySlot(entity);
+    ScheduleEntity(entity);
+}
+
+void SetupCreatedEntity(ObjectClass *object, Entity *entity, uint16 classID, void *data, int32 x, int32 y)
+{
+    memset(entity, 0, object->entityClassSize);
+    entity->position.x  = x;
+    entity->position.y  = y;
+    entity->interaction = true;
+
+    if (object->create) {
+        Entity *curEnt = sceneInfo.entity;
+
+        sceneInfo.entity = entity;
+#if RETRO_USE_MOD_LOADER
+        uint32 &superLevel = superLevels[inheritLevel];
+        uint32 superStore  = superLevel;
+        superLevel         = 0;
+#endif
+        object->create(data);
+#if RETRO_USE_MOD_LOADER
+        superLevel = superStore;
+#endif
+        entity->classID = classID;
+
+        sceneInfo.entity = curEnt;
+    }
+    else {
+        entity->classID = classID;
+        entity->active  = ACTIVE_NORMAL;
+        entity->visible = true;
+    }
+
+    UpdateTempEntitySlot(entity);
+    ScheduleEntity(entity);
 }
 
 Entity *RSDK::CreateEntity(uint16 classID, void *data, int32 x, int32 y)
@@ -1100,6 +1267,15 @@ Entity *RSDK::CreateEntity(uint16 classID, void *data, int32 x, int32 y)
     ObjectClass *object = &objectClassList[stageObjectIDs[classID]];
     Entity *entity      = &objectEntityList[sceneInfo.createSlot];
 
+    if (entity->classID && sceneInfo.createSlot >= TEMPENTITY_START) {
+        // jump straight to the next free slot along the ring, the probing below is only left to handle a completely full ring
+        int32 slot = FindFreeTempEntitySlot(sceneInfo.createSlot);
+        if (slot != -1) {
+            sceneInfo.createSlot = slot;
+            entity               = &objectEntityList[slot];
+        }
+    }
+
     int32 permCnt = 0, loopCnt = 0;
     while (entity->classID) {
         // after 16 loops, the game says fuck it and will start overwriting non-temp objects
@@ -1124,34 +1300,33 @@ Entity *RSDK::CreateEntity(uint16 classID, void *data, int32 x, int32 y)
         ++loopCnt;
     }
 
-    memset(entity, 0, object->entityClassSize);
-    entity->position.x  = x;
-    entity->position.y  = y;
-    entity->interaction = true;
+    SetupCreatedEntity(object, entity, classID, data, x, y);
+    return entity;
+}
 
-    if (object->create) {
-        Entity *curEnt = sceneInfo.entity;
+int32 RSDK::CreateEntities(uint16 classID, void *data, int32 x, int32 y, int32 count, Entity **entities)
+{
+    ObjectClass *object = &objectClassList[stageObjectIDs[classID]];
 
-        sceneInfo.entity = entity;
-#if RETRO_USE_MOD_LOADER
-        int32 superStore          = superLevels[inheritLevel];
-        superLevels[inheritLevel] = 0;
-#endif
-        object->create(data);
-#if RETRO_USE_MOD_LOADER
-        superLevels[inheritLevel] = superStore;
-#endif
-        entity->classID = classID;
+    // unlike CreateEntity this only ever uses free temp slots, so it stops early rather than overwriting anything
+    int32 created = 0;
+    for (; created < count; ++created) {
+        int32 slot = sceneInfo.createSlot;
+        if (slot < TEMPENTITY_START || objectEntityList[slot].classID)
+            slot = FindFreeTempEntitySlot(slot < TEMPENTITY_START ? ENTITY_COUNT - 1 : slot);
 
-        sceneInfo.entity = curEnt;
-    }
-    else {
-        entity->classID = classID;
-        entity->active  = ACTIVE_NORMAL;
-        entity->visible = true;
+        if (slot == -1)
+            break;
+
+        sceneInfo.createSlot = slot;
+        Entity *entity       = &objectEntityList[slot];
+        SetupCreatedEntity(object, entity, classID, data, x, y);
+
+        if (entities)
+            entities[created] = entity;
     }
 
-    return entity;
+    return created;
 }
 
 bool32 RSDK::GetActiveEntities(uint16 group, Entity **entity)
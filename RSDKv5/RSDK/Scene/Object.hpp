@@ -213,6 +213,10 @@ extern int32 stageObjectIDs[OBJECT_COUNT];
 
 extern EntityBase objectEntityList[ENTITY_COUNT];
 
+// slots the passes after the main update loop still need to visit, see ProcessObjects
+#define ENTITY_MASK_COUNT ((ENTITY_COUNT + 31) / 32)
+extern uint32 scheduledEntityMask[ENTITY_MASK_COUNT];
+
 extern EditableVarInfo *editableVarList;
 extern int32 editableVarCount;
 
@@ -297,11 +301,21 @@ int32 GetEntityCount(uint16 classID, bool32 isActive);
 void ResetEntity(Entity *entity, uint16 classID, void *data);
 void ResetEntitySlot(uint16 slot, uint16 classID, void *data);
 Entity *CreateEntity(uint16 classID, void *data, int32 x, int32 y);
+// creates up to count entities of the same class in one go (stored in entities if it's not NULL), returns how many were made
+int32 CreateEntities(uint16 classID, void *data, int32 x, int32 y, int32 count, Entity **entities);
+
+inline void ScheduleEntity(void *entity)
+{
+    uint32 slot = (uint32)((EntityBase *)entity - objectEntityList);
+    if (slot < ENTITY_COUNT)
+        scheduledEntityMask[slot >> 5] |= 1u << (slot & 31);
+}
 
 inline void CopyEntity(void *destEntity, void *srcEntity, bool32 clearSrcEntity)
 {
     if (destEntity && srcEntity) {
         memcpy(destEntity, srcEntity, sizeof(EntityBase));
+        ScheduleEntity(destEntity);
 
         if (clearSrcEntity)
             memset(srcEntity, 0, sizeof(EntityBase));
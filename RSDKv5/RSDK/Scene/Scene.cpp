@@ -1,5 +1,8 @@
 #include "RSDK/Core/RetroEngine.hpp"
 
+#include <string>
+#include <vector>
+
 using namespace RSDK;
 
 #if RETRO_REV0U
@@ -21,6 +24,10 @@ char RSDK::currentSceneID[0x10];
 
 SceneInfo RSDK::sceneInfo;
 
+void StartTileConfigJobs();
+void StartStageGIFJob();
+void FinishSceneLoadJobs();
+
 void RSDK::LoadSceneFolder()
 {
 #if RETRO_PLATFORM == RETRO_ANDROID
@@ -32,6 +39,9 @@ void RSDK::LoadSceneFolder()
     RunModCallbacks(MODCB_ONSTAGEUNLOAD, NULL);
 #endif
 
+    // snapshots point into the scene that's about to be unloaded
+    ClearSnapshots();
+
     sceneInfo.timeCounter  = 0;
     sceneInfo.minutes      = 0;
     sceneInfo.seconds      = 0;
@@ -140,6 +150,9 @@ void RSDK::LoadSceneFolder()
         screens[s].position.y = 0;
     }
 
+    // just in case a previous load never got finished
+    FinishSceneLoadJobs();
+
     SceneListEntry *sceneEntry = &sceneInfo.listData[sceneInfo.listPos];
     strcpy(currentSceneFolder, sceneEntry->folder);
 
@@ -155,9 +168,8 @@ void RSDK::LoadSceneFolder()
 
     char fullFilePath[0x40];
 
-    // Load TileConfig
-    sprintf_s(fullFilePath, sizeof(fullFilePath), "Data/Stages/%s/TileConfig.bin", currentSceneFolder);
-    LoadTileConfig(fullFilePath);
+    // Load TileConfig in the background, it gets finished up at the end of LoadSceneAssets
+    StartTileConfigJobs();
 
     // Load StageConfig
     sprintf_s(fullFilePath, sizeof(fullFilePath), "Data/Stages/%s/StageConfig.bin", currentSceneFolder);
@@ -169,9 +181,14 @@ void RSDK::LoadSceneFolder()
 
         if (sig != RSDK_SIGNATURE_CFG) {
             CloseFile(&info);
+            // 16x16Tiles never gets loaded if StageConfig is bad, so there's only TileConfig to finish up
+            FinishSceneLoadJobs();
             return;
         }
 
+        // Load 16x16Tiles in the background too, now that it's known it'll be needed
+        StartStageGIFJob();
+
         sceneInfo.useGlobalObjects = ReadInt8(&info);
         sceneInfo.classCount       = 0;
 
@@ -264,9 +281,9 @@ void RSDK::LoadSceneFolder()
 
         CloseFile(&info);
     }
-
-    sprintf_s(fullFilePath, sizeof(fullFilePath), "Data/Stages/%s/16x16Tiles.gif", currentSceneFolder);
-    LoadStageGIF(fullFilePath);
+    else {
+        StartStageGIFJob();
+    }
 
 #if RETRO_USE_MOD_LOADER
     for (int32 h = 0; h < (int32)objectHookList.size(); ++h) {
@@ -321,6 +338,7 @@ void RSDK::LoadSceneAssets()
 
         if (sig != RSDK_SIGNATURE_SCN) {
             CloseFile(&info);
+            FinishSceneLoadJobs();
             return;
         }
 
@@ -717,269 +735,292 @@ void RSDK::LoadSceneAssets()
 
         CloseFile(&info);
     }
+
+    FinishSceneLoadJobs();
+
 #if RETRO_USE_MOD_LOADER
     LoadGameXML(true); // override the stage palette *somewhere* idfk
 #endif
 }
-void RSDK::LoadTileConfig(char *filepath)
+// each tile in TileConfig.bin is: 16 heights, 16 active flags, yFlip, 4 angles & a flag
+#define TILECONFIG_ENTRY_SIZE ((TILE_SIZE * 2) + 6)
+
+// the scene folder's TileConfig & 16x16Tiles are loaded by jobs on the thread pool while the main thread gets through
+// StageConfig.bin & Scene.bin, nothing in here touches the storage allocator since it isn't thread-safe
+struct SceneLoadJobs {
+    JobGroup group;
+    std::vector<uint8> tileConfig;
+    GifDecoder gifDecoder;
+    color gifPalette[0x100];
+    bool32 gifLoaded = false;
+};
+
+SceneLoadJobs sceneLoadJobs;
+
+bool32 ReadTileConfig(const char *filepath, std::vector<uint8> &buffer)
 {
     FileInfo info;
     InitFileInfo(&info);
 
-    if (LoadFile(&info, filepath, FMODE_RB)) {
-        uint32 sig = ReadInt32(&info, false);
-        if (sig != RSDK_SIGNATURE_TIL) {
-            CloseFile(&info);
-            return;
-        }
+    if (!LoadFile(&info, filepath, FMODE_RB))
+        return false;
 
-        uint8 *buffer = NULL;
-        ReadCompressed(&info, &buffer);
-
-        int32 bufPos = 0;
-        for (int32 p = 0; p < CPATH_COUNT; ++p) {
-            // No Flip/Stored in file
-            for (int32 t = 0; t < TILE_COUNT; ++t) {
-                uint8 maskHeights[0x10];
-                uint8 maskActive[0x10];
-
-                memcpy(maskHeights, buffer + bufPos, TILE_SIZE * sizeof(uint8));
-                bufPos += TILE_SIZE;
-                memcpy(maskActive, buffer + bufPos, TILE_SIZE * sizeof(uint8));
-                bufPos += TILE_SIZE;
-
-                bool32 yFlip              = buffer[bufPos++];
-                tileInfo[p][t].floorAngle = buffer[bufPos++];
-                tileInfo[p][t].lWallAngle = buffer[bufPos++];
-                tileInfo[p][t].rWallAngle = buffer[bufPos++];
-                tileInfo[p][t].roofAngle  = buffer[bufPos++];
-                tileInfo[p][t].flag       = buffer[bufPos++];
-
-                if (yFlip) {
-                    for (int32 c = 0; c < TILE_SIZE; c++) {
-                        if (maskActive[c]) {
-                            collisionMasks[p][t].floorMasks[c] = 0x00;
-                            collisionMasks[p][t].roofMasks[c]  = maskHeights[c];
-                        }
-                        else {
-                            collisionMasks[p][t].floorMasks[c] = 0xFF;
-                            collisionMasks[p][t].roofMasks[c]  = 0xFF;
-                        }
-                    }
+    uint32 sig = ReadInt32(&info, false);
+    if (sig != RSDK_SIGNATURE_TIL) {
+        CloseFile(&info);
+        return false;
+    }
 
-                    // LWall rotations
-                    for (int32 c = 0; c < TILE_SIZE; ++c) {
-                        int32 h = 0;
-                        while (true) {
-                            if (h == TILE_SIZE) {
-                                collisionMasks[p][t].lWallMasks[c] = 0xFF;
-                                break;
-                            }
+    uint32 cSize  = ReadInt32(&info, false) - 4;
+    uint32 sizeBE = ReadInt32(&info, false);
+    uint32 sizeLE = (uint32)((sizeBE << 24) | ((sizeBE << 8) & 0x00FF0000) | ((sizeBE >> 8) & 0x0000FF00) | (sizeBE >> 24));
 
-                            uint8 m = collisionMasks[p][t].roofMasks[h];
-                            if (m != 0xFF && c <= m) {
-                                collisionMasks[p][t].lWallMasks[c] = h;
-                                break;
-                            }
-                            else {
-                                ++h;
-                                if (h <= -1)
-                                    break;
-                            }
-                        }
-                    }
+    std::vector<uint8> cBuffer(cSize);
+    ReadBytes(&info, cBuffer.data(), cSize);
+    CloseFile(&info);
 
-                    // RWall rotations
-                    for (int32 c = 0; c < TILE_SIZE; ++c) {
-                        int32 h = TILE_SIZE - 1;
-                        while (true) {
-                            if (h == -1) {
-                                collisionMasks[p][t].rWallMasks[c] = 0xFF;
-                                break;
-                            }
+    // always have enough for every plane, anything missing just reads as empty
+    buffer.assign(MAX(sizeLE, (uint32)(CPATH_COUNT * TILE_COUNT * TILECONFIG_ENTRY_SIZE)), 0);
 
-                            uint8 m = collisionMasks[p][t].roofMasks[h];
-                            if (m != 0xFF && c <= m) {
-                                collisionMasks[p][t].rWallMasks[c] = h;
-                                break;
-                            }
-                            else {
-                                --h;
-                                if (h >= TILE_SIZE)
-                                    break;
-                            }
-                        }
-                    }
+    // a corrupt file is left alone entirely rather than building the collision planes out of whatever got inflated
+    uLongf destLen = sizeLE;
+    if (uncompress(buffer.data(), &destLen, cBuffer.data(), cSize) != Z_OK) {
+        std::vector<uint8>().swap(buffer);
+        return false;
+    }
+
+    return true;
+}
+
+void LoadTileConfigPlane(uint8 *buffer, int32 p)
+{
+    int32 bufPos = p * TILE_COUNT * TILECONFIG_ENTRY_SIZE;
+
+    // No Flip/Stored in file
+    for (int32 t = 0; t < TILE_COUNT; ++t) {
+        uint8 maskHeights[0x10];
+        uint8 maskActive[0x10];
+
+        memcpy(maskHeights, buffer + bufPos, TILE_SIZE * sizeof(uint8));
+        bufPos += TILE_SIZE;
+        memcpy(maskActive, buffer + bufPos, TILE_SIZE * sizeof(uint8));
+        bufPos += TILE_SIZE;
+
+        bool32 yFlip              = buffer[bufPos++];
+        tileInfo[p][t].floorAngle = buffer[bufPos++];
+        tileInfo[p][t].lWallAngle = buffer[bufPos++];
+        tileInfo[p][t].rWallAngle = buffer[bufPos++];
+        tileInfo[p][t].roofAngle  = buffer[bufPos++];
+        tileInfo[p][t].flag       = buffer[bufPos++];
+
+        if (yFlip) {
+            for (int32 c = 0; c < TILE_SIZE; c++) {
+                if (maskActive[c]) {
+                    collisionMasks[p][t].floorMasks[c] = 0x00;
+                    collisionMasks[p][t].roofMasks[c]  = maskHeights[c];
                 }
-                else // Regular Tile
-                {
-                    // Collision heights
-                    for (int32 c = 0; c < TILE_SIZE; ++c) {
-                        if (maskActive[c]) {
-                            collisionMasks[p][t].floorMasks[c] = maskHeights[c];
-                            collisionMasks[p][t].roofMasks[c]  = 0x0F;
-                        }
-                        else {
-                            collisionMasks[p][t].floorMasks[c] = 0xFF;
-                            collisionMasks[p][t].roofMasks[c]  = 0xFF;
-                        }
-                    }
+                else {
+                    collisionMasks[p][t].floorMasks[c] = 0xFF;
+                    collisionMasks[p][t].roofMasks[c]  = 0xFF;
+                }
+            }
 
-                    // LWall rotations
-                    for (int32 c = 0; c < TILE_SIZE; ++c) {
-                        int32 h = 0;
-                        while (true) {
-                            if (h == TILE_SIZE) {
-                                collisionMasks[p][t].lWallMasks[c] = 0xFF;
-                                break;
-                            }
+            // LWall rotations
+            for (int32 c = 0; c < TILE_SIZE; ++c) {
+                int32 h = 0;
+                while (true) {
+                    if (h == TILE_SIZE) {
+                        collisionMasks[p][t].lWallMasks[c] = 0xFF;
+                        break;
+                    }
 
-                            uint8 m = collisionMasks[p][t].floorMasks[h];
-                            if (m != 0xFF && c >= m) {
-                                collisionMasks[p][t].lWallMasks[c] = h;
-                                break;
-                            }
-                            else {
-                                ++h;
-                                if (h <= -1)
-                                    break;
-                            }
-                        }
+                    uint8 m = collisionMasks[p][t].roofMasks[h];
+                    if (m != 0xFF && c <= m) {
+                        collisionMasks[p][t].lWallMasks[c] = h;
+                        break;
                     }
+                    else {
+                        ++h;
+                        if (h <= -1)
+                            break;
+                    }
+                }
+            }
 
-                    // RWall rotations
-                    for (int32 c = 0; c < TILE_SIZE; ++c) {
-                        int32 h = TILE_SIZE - 1;
-                        while (true) {
-                            if (h == -1) {
-                                collisionMasks[p][t].rWallMasks[c] = 0xFF;
-                                break;
-                            }
+            // RWall rotations
+            for (int32 c = 0; c < TILE_SIZE; ++c) {
+                int32 h = TILE_SIZE - 1;
+                while (true) {
+                    if (h == -1) {
+                        collisionMasks[p][t].rWallMasks[c] = 0xFF;
+                        break;
+                    }
 
-                            uint8 m = collisionMasks[p][t].floorMasks[h];
-                            if (m != 0xFF && c >= m) {
-                                collisionMasks[p][t].rWallMasks[c] = h;
-                                break;
-                            }
-                            else {
-                                --h;
-                                if (h >= TILE_SIZE)
-                                    break;
-                            }
-                        }
+                    uint8 m = collisionMasks[p][t].roofMasks[h];
+                    if (m != 0xFF && c <= m) {
+                        collisionMasks[p][t].rWallMasks[c] = h;
+                        break;
+                    }
+                    else {
+                        --h;
+                        if (h >= TILE_SIZE)
+                            break;
                     }
                 }
             }
-
-            // FlipX
-            for (int32 t = 0; t < TILE_COUNT; ++t) {
-                int32 off                       = (FLIP_X * TILE_COUNT);
-                tileInfo[p][t + off].flag       = tileInfo[p][t].flag;
-                tileInfo[p][t + off].floorAngle = -tileInfo[p][t].floorAngle;
-                tileInfo[p][t + off].lWallAngle = -tileInfo[p][t].rWallAngle;
-                tileInfo[p][t + off].roofAngle  = -tileInfo[p][t].roofAngle;
-                tileInfo[p][t + off].rWallAngle = -tileInfo[p][t].lWallAngle;
-
-                for (int32 c = 0; c < TILE_SIZE; ++c) {
-                    int32 h = collisionMasks[p][t].lWallMasks[c];
-                    if (h == 0xFF)
-                        collisionMasks[p][t + off].rWallMasks[c] = 0xFF;
-                    else
-                        collisionMasks[p][t + off].rWallMasks[c] = 0xF - h;
-
-                    h = collisionMasks[p][t].rWallMasks[c];
-                    if (h == 0xFF)
-                        collisionMasks[p][t + off].lWallMasks[c] = 0xFF;
-                    else
-                        collisionMasks[p][t + off].lWallMasks[c] = 0xF - h;
-
-                    collisionMasks[p][t + off].floorMasks[c] = collisionMasks[p][t].floorMasks[0xF - c];
-                    collisionMasks[p][t + off].roofMasks[c]  = collisionMasks[p][t].roofMasks[0xF - c];
+        }
+        else // Regular Tile
+        {
+            // Collision heights
+            for (int32 c = 0; c < TILE_SIZE; ++c) {
+                if (maskActive[c]) {
+                    collisionMasks[p][t].floorMasks[c] = maskHeights[c];
+                    collisionMasks[p][t].roofMasks[c]  = 0x0F;
+                }
+                else {
+                    collisionMasks[p][t].floorMasks[c] = 0xFF;
+                    collisionMasks[p][t].roofMasks[c]  = 0xFF;
                 }
             }
 
-            // FlipY
-            for (int32 t = 0; t < TILE_COUNT; ++t) {
-                int32 off                       = (FLIP_Y * TILE_COUNT);
-                tileInfo[p][t + off].flag       = tileInfo[p][t].flag;
-                tileInfo[p][t + off].floorAngle = -0x80 - tileInfo[p][t].roofAngle;
-                tileInfo[p][t + off].lWallAngle = -0x80 - tileInfo[p][t].lWallAngle;
-                tileInfo[p][t + off].roofAngle  = -0x80 - tileInfo[p][t].floorAngle;
-                tileInfo[p][t + off].rWallAngle = -0x80 - tileInfo[p][t].rWallAngle;
-
-                for (int32 c = 0; c < TILE_SIZE; ++c) {
-                    int32 h = collisionMasks[p][t].roofMasks[c];
-                    if (h == 0xFF)
-                        collisionMasks[p][t + off].floorMasks[c] = 0xFF;
-                    else
-                        collisionMasks[p][t + off].floorMasks[c] = 0xF - h;
-
-                    h = collisionMasks[p][t].floorMasks[c];
-                    if (h == 0xFF)
-                        collisionMasks[p][t + off].roofMasks[c] = 0xFF;
-                    else
-                        collisionMasks[p][t + off].roofMasks[c] = 0xF - h;
-
-                    collisionMasks[p][t + off].lWallMasks[c] = collisionMasks[p][t].lWallMasks[0xF - c];
-                    collisionMasks[p][t + off].rWallMasks[c] = collisionMasks[p][t].rWallMasks[0xF - c];
+            // LWall rotations
+            for (int32 c = 0; c < TILE_SIZE; ++c) {
+                int32 h = 0;
+                while (true) {
+                    if (h == TILE_SIZE) {
+                        collisionMasks[p][t].lWallMasks[c] = 0xFF;
+                        break;
+                    }
+
+                    uint8 m = collisionMasks[p][t].floorMasks[h];
+                    if (m != 0xFF && c >= m) {
+                        collisionMasks[p][t].lWallMasks[c] = h;
+                        break;
+                    }
+                    else {
+                        ++h;
+                        if (h <= -1)
+                            break;
+                    }
                 }
             }
 
-            // FlipXY
-            for (int32 t = 0; t < TILE_COUNT; ++t) {
-                int32 off                       = (FLIP_XY * TILE_COUNT);
-                int32 offY                      = (FLIP_Y * TILE_COUNT);
-                tileInfo[p][t + off].flag       = tileInfo[p][t + offY].flag;
-                tileInfo[p][t + off].floorAngle = -tileInfo[p][t + offY].floorAngle;
-                tileInfo[p][t + off].lWallAngle = -tileInfo[p][t + offY].rWallAngle;
-                tileInfo[p][t + off].roofAngle  = -tileInfo[p][t + offY].roofAngle;
-                tileInfo[p][t + off].rWallAngle = -tileInfo[p][t + offY].lWallAngle;
-
-                for (int32 c = 0; c < TILE_SIZE; ++c) {
-                    int32 h = collisionMasks[p][t + offY].lWallMasks[c];
-                    if (h == 0xFF)
-                        collisionMasks[p][t + off].rWallMasks[c] = 0xFF;
-                    else
-                        collisionMasks[p][t + off].rWallMasks[c] = 0xF - h;
-
-                    h = collisionMasks[p][t + offY].rWallMasks[c];
-                    if (h == 0xFF)
-                        collisionMasks[p][t + off].lWallMasks[c] = 0xFF;
-                    else
-                        collisionMasks[p][t + off].lWallMasks[c] = 0xF - h;
-
-                    collisionMasks[p][t + off].floorMasks[c] = collisionMasks[p][t + offY].floorMasks[0xF - c];
-                    collisionMasks[p][t + off].roofMasks[c]  = collisionMasks[p][t + offY].roofMasks[0xF - c];
+            // RWall rotations
+            for (int32 c = 0; c < TILE_SIZE; ++c) {
+                int32 h = TILE_SIZE - 1;
+                while (true) {
+                    if (h == -1) {
+                        collisionMasks[p][t].rWallMasks[c] = 0xFF;
+                        break;
+                    }
+
+                    uint8 m = collisionMasks[p][t].floorMasks[h];
+                    if (m != 0xFF && c >= m) {
+                        collisionMasks[p][t].rWallMasks[c] = h;
+                        break;
+                    }
+                    else {
+                        --h;
+                        if (h >= TILE_SIZE)
+                            break;
+                    }
                 }
             }
         }
+    }
 
-#if !RETRO_USE_ORIGINAL_CODE
-        RemoveStorageEntry((void **)&buffer);
-        buffer = NULL;
-#endif
-        CloseFile(&info);
+    // FlipX
+    for (int32 t = 0; t < TILE_COUNT; ++t) {
+        int32 off                       = (FLIP_X * TILE_COUNT);
+        tileInfo[p][t + off].flag       = tileInfo[p][t].flag;
+        tileInfo[p][t + off].floorAngle = -tileInfo[p][t].floorAngle;
+        tileInfo[p][t + off].lWallAngle = -tileInfo[p][t].rWallAngle;
+        tileInfo[p][t + off].roofAngle  = -tileInfo[p][t].roofAngle;
+        tileInfo[p][t + off].rWallAngle = -tileInfo[p][t].lWallAngle;
+
+        for (int32 c = 0; c < TILE_SIZE; ++c) {
+            int32 h = collisionMasks[p][t].lWallMasks[c];
+            if (h == 0xFF)
+                collisionMasks[p][t + off].rWallMasks[c] = 0xFF;
+            else
+                collisionMasks[p][t + off].rWallMasks[c] = 0xF - h;
+
+            h = collisionMasks[p][t].rWallMasks[c];
+            if (h == 0xFF)
+                collisionMasks[p][t + off].lWallMasks[c] = 0xFF;
+            else
+                collisionMasks[p][t + off].lWallMasks[c] = 0xF - h;
+
+            collisionMasks[p][t + off].floorMasks[c] = collisionMasks[p][t].floorMasks[0xF - c];
+            collisionMasks[p][t + off].roofMasks[c]  = collisionMasks[p][t].roofMasks[0xF - c];
+        }
+    }
+
+    // FlipY
+    for (int32 t = 0; t < TILE_COUNT; ++t) {
+        int32 off                       = (FLIP_Y * TILE_COUNT);
+        tileInfo[p][t + off].flag       = tileInfo[p][t].flag;
+        tileInfo[p][t + off].floorAngle = -0x80 - tileInfo[p][t].roofAngle;
+        tileInfo[p][t + off].lWallAngle = -0x80 - tileInfo[p][t].lWallAngle;
+        tileInfo[p][t + off].roofAngle  = -0x80 - tileInfo[p][t].floorAngle;
+        tileInfo[p][t + off].rWallAngle = -0x80 - tileInfo[p][t].rWallAngle;
+
+        for (int32 c = 0; c < TILE_SIZE; ++c) {
+            int32 h = collisionMasks[p][t].roofMasks[c];
+            if (h == 0xFF)
+                collisionMasks[p][t + off].floorMasks[c] = 0xFF;
+            else
+                collisionMasks[p][t + off].floorMasks[c] = 0xF - h;
+
+            h = collisionMasks[p][t].floorMasks[c];
+            if (h == 0xFF)
+                collisionMasks[p][t + off].roofMasks[c] = 0xFF;
+            else
+                collisionMasks[p][t + off].roofMasks[c] = 0xF - h;
+
+            collisionMasks[p][t + off].lWallMasks[c] = collisionMasks[p][t].lWallMasks[0xF - c];
+            collisionMasks[p][t + off].rWallMasks[c] = collisionMasks[p][t].rWallMasks[0xF - c];
+        }
+    }
+
+    // FlipXY
+    for (int32 t = 0; t < TILE_COUNT; ++t) {
+        int32 off                       = (FLIP_XY * TILE_COUNT);
+        int32 offY                      = (FLIP_Y * TILE_COUNT);
+        tileInfo[p][t + off].flag       = tileInfo[p][t + offY].flag;
+        tileInfo[p][t + off].floorAngle = -tileInfo[p][t + offY].floorAngle;
+        tileInfo[p][t + off].lWallAngle = -tileInfo[p][t + offY].rWallAngle;
+        tileInfo[p][t + off].roofAngle  = -tileInfo[p][t + offY].roofAngle;
+        tileInfo[p][t + off].rWallAngle = -tileInfo[p][t + offY].lWallAngle;
+
+        for (int32 c = 0; c < TILE_SIZE; ++c) {
+            int32 h = collisionMasks[p][t + offY].lWallMasks[c];
+            if (h == 0xFF)
+                collisionMasks[p][t + off].rWallMasks[c] = 0xFF;
+            else
+                collisionMasks[p][t + off].rWallMasks[c] = 0xF - h;
+
+            h = collisionMasks[p][t + offY].rWallMasks[c];
+            if (h == 0xFF)
+                collisionMasks[p][t + off].lWallMasks[c] = 0xFF;
+            else
+                collisionMasks[p][t + off].lWallMasks[c] = 0xF - h;
+
+            collisionMasks[p][t + off].floorMasks[c] = collisionMasks[p][t + offY].floorMasks[0xF - c];
+            collisionMasks[p][t + off].roofMasks[c]  = collisionMasks[p][t + offY].roofMasks[0xF - c];
+        }
     }
 }
-void RSDK::LoadStageGIF(char *filepath)
+
+bool32 DecodeStageGIF(const char *filepath, GifDecoder *decoder, color *palette)
 {
-    ImageGIF tileset;
+    memset(palette, 0, 0x100 * sizeof(color));
+    ImageGIF tileset(decoder, palette);
 
     if (tileset.Load(filepath, true) && tileset.width == TILE_SIZE && tileset.height <= TILE_COUNT * TILE_SIZE) {
         tileset.pixels = tilesetPixels;
         tileset.Load(NULL, false);
-
-        for (int32 r = 0; r < 0x10; ++r) {
-            // only overwrite inactive rows
-            if (!(activeStageRows[0] >> r & 1) && !(activeGlobalRows[0] >> r & 1)) {
-                for (int32 c = 0; c < 0x10; ++c) {
-                    uint8 red                    = (tileset.palette[(r << 4) + c] >> 0x10);
-                    uint8 green                  = (tileset.palette[(r << 4) + c] >> 0x08);
-                    uint8 blue                   = (tileset.palette[(r << 4) + c] >> 0x00);
-                    fullPalette[0][(r << 4) + c] = rgb32To16_B[blue] | rgb32To16_G[green] | rgb32To16_R[red];
-                }
-            }
-        }
+        tileset.pixels = NULL;
 
         // Flip X
         uint8 *srcPixels = tilesetPixels;
@@ -1016,12 +1057,82 @@ void RSDK::LoadStageGIF(char *filepath)
             dstPixels += (TILE_SIZE * 2);
         }
 
-#if RETRO_USE_ORIGINAL_CODE
-        tileset.palette = NULL;
-        tileset.decoder = NULL;
-#endif
-        tileset.pixels  = NULL;
+        return true;
     }
+
+    return false;
+}
+
+void ApplyStageGIFPalette(color *palette)
+{
+    for (int32 r = 0; r < 0x10; ++r) {
+        // only overwrite inactive rows
+        if (!(activeStageRows[0] >> r & 1) && !(activeGlobalRows[0] >> r & 1)) {
+            for (int32 c = 0; c < 0x10; ++c) {
+                uint8 red                    = (palette[(r << 4) + c] >> 0x10);
+                uint8 green                  = (palette[(r << 4) + c] >> 0x08);
+                uint8 blue                   = (palette[(r << 4) + c] >> 0x00);
+                fullPalette[0][(r << 4) + c] = rgb32To16_B[blue] | rgb32To16_G[green] | rgb32To16_R[red];
+            }
+        }
+    }
+}
+
+// TileConfig: inflate first, then each collision plane can be built in parallel
+void StartTileConfigJobs()
+{
+    char tileConfigPath[0x40];
+    sprintf_s(tileConfigPath, sizeof(tileConfigPath), "Data/Stages/%s/TileConfig.bin", currentSceneFolder);
+
+    std::string tilePath = tileConfigPath;
+    RunJob(&sceneLoadJobs.group, [tilePath] {
+        if (ReadTileConfig(tilePath.c_str(), sceneLoadJobs.tileConfig)) {
+            for (int32 p = 0; p < CPATH_COUNT; ++p) RunJob(&sceneLoadJobs.group, [p] { LoadTileConfigPlane(sceneLoadJobs.tileConfig.data(), p); });
+        }
+    });
+}
+
+// 16x16Tiles: the palette depends on StageConfig's active rows, so that part gets applied once everything's finished
+void StartStageGIFJob()
+{
+    char stageGIFPath[0x40];
+    sprintf_s(stageGIFPath, sizeof(stageGIFPath), "Data/Stages/%s/16x16Tiles.gif", currentSceneFolder);
+
+    sceneLoadJobs.gifLoaded = false;
+
+    std::string gifPath = stageGIFPath;
+    RunJob(&sceneLoadJobs.group, [gifPath] {
+        sceneLoadJobs.gifLoaded = DecodeStageGIF(gifPath.c_str(), &sceneLoadJobs.gifDecoder, sceneLoadJobs.gifPalette);
+    });
+}
+
+void FinishSceneLoadJobs()
+{
+    WaitForJobGroup(&sceneLoadJobs.group);
+
+    if (sceneLoadJobs.gifLoaded)
+        ApplyStageGIFPalette(sceneLoadJobs.gifPalette);
+
+    sceneLoadJobs.gifLoaded = false;
+    std::vector<uint8>().swap(sceneLoadJobs.tileConfig);
+}
+
+void RSDK::LoadTileConfig(char *filepath)
+{
+    FinishSceneLoadJobs();
+
+    if (ReadTileConfig(filepath, sceneLoadJobs.tileConfig)) {
+        for (int32 p = 0; p < CPATH_COUNT; ++p) LoadTileConfigPlane(sceneLoadJobs.tileConfig.data(), p);
+    }
+
+    std::vector<uint8>().swap(sceneLoadJobs.tileConfig);
+}
+void RSDK::LoadStageGIF(char *filepath)
+{
+    FinishSceneLoadJobs();
+
+    if (DecodeStageGIF(filepath, &sceneLoadJobs.gifDecoder, sceneLoadJobs.gifPalette))
+        ApplyStageGIFPalette(sceneLoadJobs.gifPalette);
 }
 
 void RSDK::ProcessParallaxAutoScroll()
@@ -1036,6 +1147,170 @@ void RSDK::ProcessParallaxAutoScroll()
         }
     }
 }
+// Parallax Cache
+ParallaxCache parallaxCache[LAYER_COUNT][SCREEN_COUNT];
+
+ParallaxCache *GetParallaxCache(TileLayer *layer)
+{
+    if (layer < tileLayers || layer >= &tileLayers[LAYER_COUNT] || currentScreen < screens || currentScreen >= &screens[SCREEN_COUNT])
+        return NULL;
+
+    if (currentScreen->size.x > SCREEN_XMAX || currentScreen->size.y > SCREEN_YSIZE)
+        return NULL;
+
+    // anything outside of this writes a different number of scanlines than the screen's height, so it's always generated
+    if (currentScreen->waterDrawPos < 0 || currentScreen->waterDrawPos > currentScreen->size.y)
+        return NULL;
+
+    return &parallaxCache[layer - tileLayers][currentScreen - screens];
+}
+
+void SetupParallaxKey(ParallaxKey *key, TileLayer *layer, int32 scrollPosX, int32 scrollPosY)
+{
+    memset(key, 0, sizeof(ParallaxKey));
+    key->type               = layer->type;
+    key->pixelWidth         = TILE_SIZE * layer->xsize;
+    key->pixelHeight        = TILE_SIZE * layer->ysize;
+    key->screenWidth        = currentScreen->size.x;
+    key->screenHeight       = currentScreen->size.y;
+    key->waterDrawPos       = currentScreen->waterDrawPos;
+    key->scrollPosX         = scrollPosX;
+    key->scrollPosY         = scrollPosY;
+    key->deformationOffset  = layer->deformationOffset;
+    key->deformationOffsetW = layer->deformationOffsetW;
+
+    switch (layer->type) {
+        default: break;
+
+        case LAYER_HSCROLL: {
+            key->lineCount = currentScreen->size.y;
+
+            // lineScroll can point a line at any of the 0x100 scroll infos, so check the ones the visible lines actually use
+            uint8 *lineScroll = &layer->lineScroll[scrollPosY];
+            for (int32 i = 0, pos = scrollPosY; i < key->lineCount; ++i) {
+                if (layer->scrollInfo[*lineScroll].deform) {
+                    key->deformCount = key->lineCount;
+                    break;
+                }
+
+                if (++pos == key->pixelHeight) {
+                    lineScroll = layer->lineScroll;
+                    pos        = 0;
+                }
+                else {
+                    ++lineScroll;
+                }
+            }
+            break;
+        }
+
+        case LAYER_VSCROLL: key->lineCount = currentScreen->size.x; break;
+
+        case LAYER_BASIC: key->lineCount = currentScreen->size.y; break;
+    }
+}
+
+// the deformation tables are read from two spots, one for the lines above the water & one for the lines below it
+int32 *GetParallaxDeformation(TileLayer *layer, ParallaxKey *key, bool32 underWater)
+{
+    if (underWater) {
+        int32 scrollPos = (key->scrollPosY + key->waterDrawPos) % key->pixelHeight;
+        return &layer->deformationDataW[(scrollPos + (uint16)key->deformationOffsetW) & 0x1FF];
+    }
+
+    return &layer->deformationData[(key->scrollPosY + (uint16)key->deformationOffset) & 0x1FF];
+}
+
+// the line scroll is read from the scroll pos onwards, wrapping around at the end of the layer (maybe more than once, if it's tiny)
+bool32 ParallaxLinesMatch(ParallaxCache *cache, TileLayer *layer)
+{
+    int32 start = cache->key.type == LAYER_VSCROLL ? cache->key.scrollPosX : cache->key.scrollPosY;
+    int32 size  = cache->key.type == LAYER_VSCROLL ? cache->key.pixelWidth : cache->key.pixelHeight;
+
+    for (int32 i = 0; i < cache->key.lineCount; start = 0) {
+        int32 count = MIN(cache->key.lineCount - i, size - start);
+        if (memcmp(&cache->lineScroll[i], &layer->lineScroll[start], count))
+            return false;
+
+        i += count;
+    }
+
+    return true;
+}
+
+// everything that isn't part of the key: the scroll info & the parts of the tables that were read
+bool32 CheckParallaxCache(ParallaxCache *cache, TileLayer *layer)
+{
+    // tilePos has already been updated for this screen by now, so this catches the camera moving along with everything else
+    if (memcmp(cache->scrollInfo, layer->scrollInfo, sizeof(layer->scrollInfo)))
+        return false;
+
+    if (!ParallaxLinesMatch(cache, layer))
+        return false;
+
+    if (cache->key.deformCount) {
+        int32 waterDrawPos = cache->key.waterDrawPos;
+        if (memcmp(cache->deformation, GetParallaxDeformation(layer, &cache->key, false), waterDrawPos * sizeof(int32)))
+            return false;
+
+        if (memcmp(&cache->deformation[waterDrawPos], GetParallaxDeformation(layer, &cache->key, true),
+                   (cache->key.deformCount - waterDrawPos) * sizeof(int32)))
+            return false;
+    }
+
+    return true;
+}
+
+// copies the cached scanlines back if nothing they depend on changed
+// otherwise cachePtr gets set to the cache the new scanlines should be kept in (if there is one), with the key already set up
+bool32 UseCachedParallax(TileLayer *layer, int32 scrollPosX, int32 scrollPosY, ParallaxCache **cachePtr)
+{
+    ParallaxCache *cache = GetParallaxCache(layer);
+    if (!cache)
+        return false;
+
+    // the scroll positions are int16s, so they can wrap around on huge layers. those are just generated every time
+    if (scrollPosX < 0 || scrollPosX >= TILE_SIZE * layer->xsize || scrollPosY < 0 || scrollPosY >= TILE_SIZE * layer->ysize)
+        return false;
+
+    ParallaxKey key;
+    SetupParallaxKey(&key, layer, scrollPosX, scrollPosY);
+    if (!cache->valid || memcmp(&key, &cache->key, sizeof(ParallaxKey)) || !CheckParallaxCache(cache, layer)) {
+        cache->valid = false;
+        cache->key   = key;
+        *cachePtr    = cache;
+        return false;
+    }
+
+    memcpy(scanlines, cache->scanlines, cache->scanlineCount * sizeof(ScanlineInfo));
+    return true;
+}
+
+void CacheParallax(ParallaxCache *cache, TileLayer *layer, int32 scanlineCount)
+{
+    memcpy(cache->scrollInfo, layer->scrollInfo, sizeof(layer->scrollInfo));
+
+    int32 start = cache->key.type == LAYER_VSCROLL ? cache->key.scrollPosX : cache->key.scrollPosY;
+    int32 size  = cache->key.type == LAYER_VSCROLL ? cache->key.pixelWidth : cache->key.pixelHeight;
+    for (int32 i = 0; i < cache->key.lineCount; start = 0) {
+        int32 count = MIN(cache->key.lineCount - i, size - start);
+        memcpy(&cache->lineScroll[i], &layer->lineScroll[start], count);
+
+        i += count;
+    }
+
+    if (cache->key.deformCount) {
+        int32 waterDrawPos = cache->key.waterDrawPos;
+        memcpy(cache->deformation, GetParallaxDeformation(layer, &cache->key, false), waterDrawPos * sizeof(int32));
+        memcpy(&cache->deformation[waterDrawPos], GetParallaxDeformation(layer, &cache->key, true),
+               (cache->key.deformCount - waterDrawPos) * sizeof(int32));
+    }
+
+    cache->scanlineCount = scanlineCount;
+    memcpy(cache->scanlines, scanlines, scanlineCount * sizeof(ScanlineInfo));
+    cache->valid = true;
+}
+
 void RSDK::ProcessParallax(TileLayer *layer)
 {
     if (!layer->xsize || !layer->ysize)
@@ -1045,6 +1320,7 @@ void RSDK::ProcessParallax(TileLayer *layer)
     int32 pixelHeight      = TILE_SIZE * layer->ysize;
     ScanlineInfo *scanline = scanlines;
     ScrollInfo *scrollInfo = layer->scrollInfo;
+    ParallaxCache *cache   = NULL;
 
     switch (layer->type) {
         default: break;
@@ -1066,6 +1342,9 @@ void RSDK::ProcessParallax(TileLayer *layer)
             if (scrollPos < 0)
                 scrollPos += pixelHeight;
 
+            if (UseCachedParallax(layer, 0, scrollPos, &cache))
+                break;
+
             uint8 *lineScrollPtr = &layer->lineScroll[scrollPos];
 
             // Above water
@@ -1107,6 +1386,9 @@ void RSDK::ProcessParallax(TileLayer *layer)
                 }
                 scanline++;
             }
+
+            if (cache)
+                CacheParallax(cache, layer, (int32)(scanline - scanlines));
             break;
         }
 
@@ -1123,6 +1405,9 @@ void RSDK::ProcessParallax(TileLayer *layer)
             if (scrollPos < 0)
                 scrollPos += pixelWidth;
 
+            if (UseCachedParallax(layer, scrollPos, 0, &cache))
+                break;
+
             uint8 *lineScrollPtr = &layer->lineScroll[scrollPos];
 
             // Above water
@@ -1140,6 +1425,9 @@ void RSDK::ProcessParallax(TileLayer *layer)
 
                 scanline++;
             }
+
+            if (cache)
+                CacheParallax(cache, layer, (int32)(scanline - scanlines));
             break;
         }
 
@@ -1154,6 +1442,9 @@ void RSDK::ProcessParallax(TileLayer *layer)
             if (scrollPosY < 0)
                 scrollPosY += pixelHeight;
 
+            if (UseCachedParallax(layer, scrollPosX, scrollPosY, &cache))
+                break;
+
             for (int32 i = 0; i < currentScreen->size.y; ++i) {
                 scanline->position.x = TO_FIXED(scrollPosX);
                 scanline->position.y = TO_FIXED(scrollPosY++);
@@ -1162,6 +1453,9 @@ void RSDK::ProcessParallax(TileLayer *layer)
 
                 scanline++;
             }
+
+            if (cache)
+                CacheParallax(cache, layer, (int32)(scanline - scanlines));
             break;
         }
 
@@ -1182,6 +1476,9 @@ void RSDK::ProcessParallax(TileLayer *layer)
             if (scrollPos < 0)
                 scrollPos += pixelHeight;
 
+            if (UseCachedParallax(layer, 0, scrollPos, &cache))
+                break;
+
             uint8 *lineScrollPtr = &layer->lineScroll[scrollPos];
 
             // Above water
@@ -1214,6 +1511,9 @@ void RSDK::ProcessParallax(TileLayer *layer)
 
                 scanline++;
             }
+
+            if (cache)
+                CacheParallax(cache, layer, (int32)(scanline - scanlines));
             break;
         }
     }
@@ -1600,36 +1900,27 @@ void RSDK::DrawLayerRotozoom(TileLayer *layer)
     ScanlineInfo *scanline = &scanlines[currentScreen->clipBound_Y1];
     uint16 *frameBuffer    = &currentScreen->frameBuffer[currentScreen->clipBound_X1 + currentScreen->clipBound_Y1 * currentScreen->pitch];
 
-    int32 width    = (TILE_SIZE << layer->widthShift) - 1;
-    int32 height   = (TILE_SIZE << layer->heightShift) - 1;
-    int32 lineSize = currentScreen->clipBound_X2 - currentScreen->clipBound_X1;
+    int32 width      = (TILE_SIZE << layer->widthShift) - 1;
+    int32 height     = (TILE_SIZE << layer->heightShift) - 1;
+    int32 lineSize   = currentScreen->clipBound_X2 - currentScreen->clipBound_X1;
+    int32 widthShift = layer->widthShift;
+    int32 tileMaskX  = width >> 4;
+    int32 tileMaskY  = height >> 4;
 
-    for (int32 cy = currentScreen->clipBound_Y1; cy < currentScreen->clipBound_Y2; ++cy) {
-        int32 posX = scanline->position.x;
-        int32 posY = scanline->position.y;
+    auto fetchTile = [layout, widthShift, tileMaskX, tileMaskY](int32 tx, int32 ty) {
+        uint16 tile = layout[(tileMaskX & tx) + ((tileMaskY & ty) << widthShift)] & 0xFFF;
+        return Mode7Tile{ &tilesetPixels[TILE_DATASIZE * tile], 1, TILE_SIZE };
+    };
 
+    uint8 indices[SCREEN_XMAX];
+    for (int32 cy = currentScreen->clipBound_Y1; cy < currentScreen->clipBound_Y2; ++cy) {
         uint16 *activePalette = fullPalette[*lineBuffer];
         ++lineBuffer;
-        int32 fbOffset = currentScreen->pitch - lineSize;
-
-        for (int32 cx = 0; cx < lineSize; ++cx) {
-            int32 tx = posX >> 20;
-            int32 ty = posY >> 20;
-            int32 x  = FROM_FIXED(posX) & 0xF;
-            int32 y  = FROM_FIXED(posY) & 0xF;
 
-            uint16 tile = layout[((width >> 4) & tx) + (((height >> 4) & ty) << layer->widthShift)] & 0xFFF;
-            uint8 idx   = tilesetPixels[TILE_SIZE * (y + TILE_SIZE * tile) + x];
-
-            if (idx)
-                *frameBuffer = activePalette[idx];
-
-            posX += scanline->deform.x;
-            posY += scanline->deform.y;
-            ++frameBuffer;
-        }
+        SampleMode7Line(indices, lineSize, scanline->position.x, scanline->position.y, scanline->deform.x, scanline->deform.y, 16, fetchTile);
+        DrawIndexedLine(frameBuffer, indices, lineSize, activePalette);
 
-        frameBuffer += fbOffset;
+        frameBuffer += currentScreen->pitch;
         ++scanline;
     }
 }
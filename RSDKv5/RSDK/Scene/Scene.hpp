@@ -146,6 +146,35 @@ struct TileInfo {
     uint8 flag;
 };
 
+// ProcessParallax keeps the last scanlines it generated for each layer on each screen, along with everything they were generated from
+// if none of that changed (static backgrounds, menus, a camera that's standing still) the old scanlines get copied back instead
+// layers with a scanlineCallback always run it, since there's no telling what it reads
+struct ParallaxKey {
+    int32 type;
+    int32 pixelWidth;
+    int32 pixelHeight;
+    int32 screenWidth;
+    int32 screenHeight;
+    int32 waterDrawPos;
+    int32 scrollPosX;
+    int32 scrollPosY;
+    int32 deformationOffset;
+    int32 deformationOffsetW;
+    int32 lineCount;   // how much of the layer's lineScroll was read
+    int32 deformCount; // how much of the deformation tables was read, 0 if no scroll info uses them
+};
+
+struct ParallaxCache {
+    bool32 valid;
+    ParallaxKey key;
+    ScrollInfo scrollInfo[0x100];
+    // games write the line scroll & deformation tables directly, so the parts that were read are kept to check them against
+    uint8 lineScroll[SCREEN_XMAX];
+    int32 deformation[SCREEN_YSIZE];
+    int32 scanlineCount;
+    ScanlineInfo scanlines[SCREEN_XMAX];
+};
+
 extern ScanlineInfo *scanlines;
 extern TileLayer tileLayers[LAYER_COUNT];
 
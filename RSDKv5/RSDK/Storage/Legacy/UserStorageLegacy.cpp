@@ -36,6 +36,7 @@ int32 RSDK::Legacy::GetGlobalVariableID(const char *name)
 }
 
 bool32 RSDK::Legacy::ReadSaveRAM() { return SKU::LoadUserFile("SGame.bin", saveRAM, sizeof(saveRAM)); }
+// scripts only get the result through checkResult, so this can't be queued like the other saves
 bool32 RSDK::Legacy::WriteSaveRAM() { return SKU::SaveUserFile("SGame.bin", saveRAM, sizeof(saveRAM)); }
 
 void RSDK::Legacy::v3::SetAchievement(int32 achievementID, int32 achievementDone)
@@ -328,6 +328,8 @@ void RSDK::CopyStorage(uint32 **src, uint32 **dst)
     }
 }
 
+uint32 RSDK::GetStorageSize(void *data) { return data ? HEADER(((uint32 *)data), HEADER_DATA_LENGTH) : 0; }
+
 void RSDK::GarbageCollectStorage(StorageDataSets set)
 {
     if ((uint32)set < DATASET_MAX) {
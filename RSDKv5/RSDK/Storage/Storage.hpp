@@ -82,6 +82,23 @@ public:
         }
     }
 
+    // drops everything past newCount in one go, rather than removing entries one at a time
+    void Shrink(int32 newCount)
+    {
+        if (newCount >= count)
+            return;
+
+        count = newCount < 0 ? 0 : newCount;
+        while (length - 32 > count) length -= 32;
+
+        if (entries && length) {
+            T *entries_realloc = (T *)realloc(entries, sizeof(T) * length);
+
+            if (entries_realloc)
+                entries = entries_realloc;
+        }
+    }
+
     inline T *At(int32 index) { return &entries[index]; }
 
     inline void Clear(bool32 dealloc = false)
@@ -108,6 +125,8 @@ void AllocateStorage(void **dataPtr, uint32 size, StorageDataSets dataSet, bool3
 void DefragmentAndGarbageCollectStorage(StorageDataSets set);
 void RemoveStorageEntry(void **dataPtr);
 void CopyStorage(uint32 **src, uint32 **dst);
+// the size (in bytes) that an allocation was made with
+uint32 GetStorageSize(void *data);
 void GarbageCollectStorage(StorageDataSets dataSet);
 
 #if RETRO_REV0U
@@ -321,6 +321,7 @@ void RSDK::LoadSettingsINI()
         customSettings.xyButtonFlip              = customSettings.confirmButtonFlip;
         customSettings.enableControllerDebugging = iniparser_getboolean(ini, "Game:enableControllerDebugging", false);
         customSettings.disableFocusPause         = iniparser_getboolean(ini, "Game:disableFocusPause", false);
+        customSettings.fileLogLevel              = iniparser_getint(ini, "Game:fileLogLevel", 0);
 #if RETRO_USERCORE_DUMMY
         customSettings.dlcEnabled                = iniparser_getboolean(ini, "Game:dlcEnabled", false);
 #endif
@@ -515,6 +516,7 @@ void RSDK::LoadSettingsINI()
         customSettings.xyButtonFlip              = false;
         customSettings.enableControllerDebugging = false;
         customSettings.disableFocusPause         = false;
+        customSettings.fileLogLevel              = 0;
 #if RETRO_USERCORE_DUMMY
         customSettings.dlcEnabled                = false;
 #endif
@@ -619,6 +621,9 @@ void RSDK::SaveSettingsINI(bool32 writeToFile)
             WriteText(file, "; Determines if the engine should pause when window focus is lost or not\n");
             WriteText(file, "disableFocusPause=%s\n", (customSettings.disableFocusPause ? "y" : "n"));
 
+            WriteText(file, "; Minimum severity written to log.txt (0 = everything, 1 = popups, 2 = errors, 3 = fatal errors, 4 = nothing)\n");
+            WriteText(file, "fileLogLevel=%d\n", customSettings.fileLogLevel);
+
             if (strcmp(iniparser_getstring(ini, "Game:username", ";unknown;"), ";unknown;") != 0)
                 WriteText(file, "username=%s\n", iniparser_getstring(ini, "Game:username", ""));
 
@@ -18,6 +18,7 @@ struct CustomSettings {
     bool32 dlcEnabled;
 #endif
     int32 maxPixWidth;
+    int32 fileLogLevel;
     char username[0x80];
 };
 
@@ -1,5 +1,13 @@
 #include "RSDK/Core/RetroEngine.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace RSDK;
+
 #if RETRO_REV02
 
 // ====================
@@ -34,8 +42,6 @@ namespace SKU
 } // namespace SKU
 } // namespace RSDK
 
-using namespace RSDK;
-
 RSDK::SKU::UserStorage *RSDK::SKU::userStorage     = NULL;
 RSDK::SKU::UserDBStorage *RSDK::SKU::userDBStorage = NULL;
 
@@ -319,8 +325,9 @@ void RSDK::SKU::UserDB::Init(va_list list)
     rowCount    = 0;
     memset(rows, 0, sizeof(rows));
     Refresh();
-    active = true;
-    valid  = true;
+    rowLookupValid = false;
+    active         = true;
+    valid          = true;
 }
 bool32 RSDK::SKU::UserDB::Load(uint8 *buffer)
 {
@@ -365,7 +372,8 @@ bool32 RSDK::SKU::UserDB::Load(uint8 *buffer)
         }
     }
 
-    active = true;
+    active         = true;
+    rowLookupValid = false;
     Refresh();
     return true;
 }
@@ -454,7 +462,8 @@ void RSDK::SKU::UserDB::Clear()
     memset(columnNames, 0, sizeof(columnNames));
     memset(columnUUIDs, 0, sizeof(columnUUIDs));
     memset(rows, 0, sizeof(rows));
-    rowsChanged = true;
+    rowsChanged    = true;
+    rowLookupValid = false;
 }
 
 int32 RSDK::SKU::UserDB::GetColumnID(const char *name)
@@ -489,6 +498,8 @@ int32 RSDK::SKU::UserDB::AddRow()
     memcpy(&row->changeTime, tmB, sizeof(tm));
 
     memset(row->values, 0, sizeof(UserDBValue) * RETRO_USERDB_COL_MAX);
+    if (rowLookupValid)
+        rowLookup[row->uuid] = rowCount;
     ++rowCount;
     valid = true;
 
@@ -507,7 +518,8 @@ bool32 RSDK::SKU::UserDB::RemoveRow(uint32 row)
         memset(&entry[id + 1], 0, sizeof(UserDBRow));
 
         --rowCount;
-        valid = true;
+        valid          = true;
+        rowLookupValid = false;
 
         Refresh();
         rowsChanged = true;
@@ -518,6 +530,7 @@ bool32 RSDK::SKU::UserDB::RemoveAllRows()
 {
     rowCount = 0;
     memset(rows, 0, sizeof(UserDBRow) * RETRO_USERDB_ROW_MAX);
+    rowLookupValid = false;
     Refresh();
     return true;
 }
@@ -526,21 +539,25 @@ uint16 RSDK::SKU::UserDB::GetRowByID(uint32 uuid)
     if (!rowCount)
         return -1;
 
-    for (int32 i = 0; i < rowCount; ++i) {
-        if (uuid == rows[i].uuid) {
-            return i;
-        }
-    }
+    RefreshRowLookup();
+
+    auto entry = rowLookup.find(uuid);
+    if (entry != rowLookup.end())
+        return entry->second;
+
     return -1;
 }
 
 void RSDK::SKU::UserDB::FilterValues(UserDBValue *value, int32 column)
 {
-    for (int32 i = sortedRowList.Count() - 1; i >= 0; --i) {
-        if (!value->CheckMatch(sortedRowIDs[i], column)) {
-            sortedRowList.Remove(i);
-        }
+    // compact the matching rows down in a single pass, then drop the leftovers off the end
+    int32 count = 0;
+    for (int32 i = 0; i < sortedRowList.Count(); ++i) {
+        if (value->CheckMatch(sortedRowIDs[i], column))
+            *sortedRowList.At(count++) = *sortedRowList.At(i);
     }
+
+    sortedRowList.Shrink(count);
 }
 void RSDK::SKU::UserDB::AddSortFilter(const char *name, void *value)
 {
@@ -582,52 +599,68 @@ void RSDK::SKU::UserDB::RefreshSortList()
 
     SetupRowSortIDs();
 }
+// sort keys are pulled out of the rows once up front, so the actual sort doesn't need to keep decoding values (or calling mktime)
+struct UserDBSortKey {
+    int32 rowID;
+    double value;
+    char string[0x10];
+};
+
 void RSDK::SKU::UserDB::SortRows(int32 type, char *name, bool32 sortAscending)
 {
     if (!rowsChanged && sortedRowCount) {
-        if (type || name) { // sort by value
-            int32 col = GetColumnID(name);
-            if (col >= 0) {
-                for (int32 i = 0; i < sortedRowList.Count(); i++) {
-                    for (int32 j = i + 1; j < sortedRowList.Count(); j++) {
-                        int32 *id1 = sortedRowList.At(i);
-                        int32 *id2 = sortedRowList.At(j);
-
-                        if (rows[*id1].Compare(&rows[*id2], type, name, sortAscending)) {
-                            int32 temp = *id1;
-                            *id1       = *id2;
-                            *id2       = temp;
-                        }
-                    }
-                }
+        bool32 sortByDate = !type && !name;
+        if (!sortByDate && GetColumnID(name) < 0)
+            return;
+
+        std::vector<UserDBSortKey> keys(sortedRowList.Count());
+        for (int32 i = 0; i < sortedRowList.Count(); ++i) {
+            UserDBSortKey *key = &keys[i];
+            UserDBRow *row     = &rows[*sortedRowList.At(i)];
+            key->rowID         = *sortedRowList.At(i);
+            key->value         = 0.0;
+            memset(key->string, 0, sizeof(key->string));
+
+            if (sortByDate) {
+                key->value = (double)mktime(&row->createTime);
+                continue;
+            }
 
-                SetupRowSortIDs();
+            uint8 data[0x10];
+            memset(data, 0, sizeof(data));
+            row->GetValue(type, name, data);
+
+            switch (type) {
+                case DBVAR_BOOL:
+                case DBVAR_UINT8: key->value = *(uint8 *)data; break;
+                case DBVAR_INT8: key->value = *(int8 *)data; break;
+                case DBVAR_UINT16: key->value = *(uint16 *)data; break;
+                case DBVAR_INT16: key->value = *(int16 *)data; break;
+                case DBVAR_UINT32:
+                case DBVAR_COLOR: key->value = *(uint32 *)data; break;
+                case DBVAR_INT32: key->value = *(int32 *)data; break;
+                case DBVAR_FLOAT: key->value = *(float *)data; break;
+                case DBVAR_STRING: memcpy(key->string, data, sizeof(key->string)); break;
+                default: break;
             }
         }
-        else { // sort by date
-            for (int32 i = 0; i < sortedRowList.Count(); i++) {
-                for (int32 j = i + 1; j < sortedRowList.Count(); j++) {
-                    int32 *id1 = sortedRowList.At(i);
-                    int32 *id2 = sortedRowList.At(j);
-
-                    double d = difftime(mktime(&rows[*id1].createTime), mktime(&rows[*id2].createTime));
-
-                    bool32 swap = false;
-                    if (sortAscending)
-                        swap = (d < 0) - (d > 0);
-                    else
-                        swap = (d > 0) - (d < 0);
-
-                    if (swap) {
-                        int32 temp = *id1;
-                        *id1       = *id2;
-                        *id2       = temp;
-                    }
-                }
-            }
 
-            SetupRowSortIDs();
+        // matches the ordering UserDBRow::Compare gives: "ascending" puts larger values (or newer dates) first, except for strings
+        if (type == DBVAR_STRING) {
+            std::stable_sort(keys.begin(), keys.end(), [sortAscending](const UserDBSortKey &a, const UserDBSortKey &b) {
+                int32 result = strncmp(a.string, b.string, sizeof(a.string));
+                return sortAscending ? result < 0 : result > 0;
+            });
+        }
+        else {
+            std::stable_sort(keys.begin(), keys.end(), [sortAscending](const UserDBSortKey &a, const UserDBSortKey &b) {
+                return sortAscending ? a.value > b.value : a.value < b.value;
+            });
         }
+
+        for (int32 i = 0; i < sortedRowList.Count(); ++i) *sortedRowList.At(i) = keys[i].rowID;
+
+        SetupRowSortIDs();
     }
 }
 
@@ -636,6 +669,8 @@ uint32 RSDK::SKU::UserDB::CreateRowUUID()
     bool32 flag = true;
     uint32 uuid = 0;
 
+    RefreshRowLookup();
+
     while (flag) {
         uint8 bytes[4];
         bytes[0] = rand();
@@ -647,15 +682,22 @@ uint32 RSDK::SKU::UserDB::CreateRowUUID()
         if (uuid < 0x10000000)
             uuid |= 0x10000000;
 
-        flag = false;
-        for (int32 e = 0; e < rowCount; ++e) {
-            if (uuid == rows[e].uuid) {
-                flag = true;
-            }
-        }
+        flag = rowLookup.find(uuid) != rowLookup.end();
     }
     return uuid;
 }
+void RSDK::SKU::UserDB::RefreshRowLookup()
+{
+    if (rowLookupValid)
+        return;
+
+    rowLookup.clear();
+    rowLookup.reserve(rowCount);
+    // if any uuids are doubled up, the first row wins like the old linear search did
+    for (int32 r = rowCount - 1; r >= 0; --r) rowLookup[rows[r].uuid] = r;
+
+    rowLookupValid = true;
+}
 void RSDK::SKU::UserDB::Refresh()
 {
     parent = this;
@@ -1024,8 +1066,110 @@ void (*RSDK::SKU::preLoadSaveFileCB)();
 void (*RSDK::SKU::postLoadSaveFileCB)();
 char RSDK::SKU::userFileDir[0x100];
 
+struct UserFileWrite {
+    std::string path;
+    std::vector<uint8> data;
+    std::vector<void (*)(int32 status)> callbacks;
+};
+
+struct UserFileWriteResult {
+    std::vector<void (*)(int32 status)> callbacks;
+    int32 status;
+};
+
+std::deque<UserFileWrite> userFileWriteQueue;
+std::vector<UserFileWriteResult> userFileWriteResults;
+std::mutex userFileWriteMutex;
+bool32 userFileWriterActive = false;
+JobGroup userFileWriteGroup;
+
+void GetUserFilePath(char *buffer, size_t size, const char *filename)
+{
+#if RETRO_USE_MOD_LOADER
+    if (strlen(customUserFileDir))
+        sprintf_s(buffer, size, "%s%s", customUserFileDir, filename);
+    else
+        sprintf_s(buffer, size, "%s%s", SKU::userFileDir, filename);
+#else
+    sprintf_s(buffer, size, "%s%s", SKU::userFileDir, filename);
+#endif
+}
+
+#if RETRO_PLATFORM != RETRO_ANDROID
+// writes to a temp file first & swaps it in once it's all there, so a crash mid-save can't leave a half written file behind
+bool32 WriteUserFile(const char *path, void *buffer, uint32 bufSize)
+{
+    char tempPath[0x400];
+    sprintf_s(tempPath, sizeof(tempPath), "%s.tmp", path);
+
+    FileIO *file = fOpen(tempPath, "wb");
+    if (!file)
+        return false;
+
+    bool32 success = fWrite(buffer, 1, bufSize, file) == bufSize;
+    if (fClose(file) != 0)
+        success = false;
+
+    if (success) {
+#if RETRO_PLATFORM == RETRO_WIN
+        success = MoveFileExA(tempPath, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#elif RETRO_PLATFORM == RETRO_UWP
+        // no replacing rename here, so this is the best we can do
+        remove(path);
+        success = rename(tempPath, path) == 0;
+#else
+        success = rename(tempPath, path) == 0;
+#endif
+    }
+
+    if (!success)
+        remove(tempPath);
+
+    return success;
+}
+#else
+// android files are opened through the java side, so there's no temp file to swap in
+bool32 WriteUserFile(const char *path, void *buffer, uint32 bufSize)
+{
+    FileIO *file = fOpen(path, "wb");
+    if (!file)
+        return false;
+
+    fWrite(buffer, 1, bufSize, file);
+    fClose(file);
+    return true;
+}
+#endif
+
+void RunUserFileWriter()
+{
+    while (true) {
+        UserFileWrite write;
+        {
+            std::lock_guard<std::mutex> lock(userFileWriteMutex);
+            if (userFileWriteQueue.empty()) {
+                userFileWriterActive = false;
+                return;
+            }
+
+            write = std::move(userFileWriteQueue.front());
+            userFileWriteQueue.pop_front();
+        }
+
+        bool32 success = WriteUserFile(write.path.c_str(), write.data.data(), (uint32)write.data.size());
+        if (!success)
+            PrintLog(PRINT_NORMAL, "Failed to save user file: %s", write.path.c_str());
+
+        std::lock_guard<std::mutex> lock(userFileWriteMutex);
+        userFileWriteResults.push_back({ std::move(write.callbacks), success ? SKU::STATUS_OK : SKU::STATUS_ERROR });
+    }
+}
+
 bool32 RSDK::SKU::LoadUserFile(const char *filename, void *buffer, uint32 bufSize)
 {
+    // make sure we don't read back anything older than what was last saved
+    FlushUserFileWrites();
+
     if (preLoadSaveFileCB)
         preLoadSaveFileCB();
 
@@ -1067,38 +1211,89 @@ bool32 RSDK::SKU::LoadUserFile(const char *filename, void *buffer, uint32 bufSiz
 }
 bool32 RSDK::SKU::SaveUserFile(const char *filename, void *buffer, uint32 bufSize)
 {
+    FlushUserFileWrites();
+
     if (preLoadSaveFileCB)
         preLoadSaveFileCB();
 
     char fullFilePath[0x400];
-#if RETRO_USE_MOD_LOADER
-    if (strlen(customUserFileDir))
-        sprintf_s(fullFilePath, sizeof(fullFilePath), "%s%s", customUserFileDir, filename);
-    else
-        sprintf_s(fullFilePath, sizeof(fullFilePath), "%s%s", userFileDir, filename);
-#else
-    sprintf_s(fullFilePath, sizeof(fullFilePath), "%s%s", userFileDir, filename);
-#endif
+    GetUserFilePath(fullFilePath, sizeof(fullFilePath), filename);
     PrintLog(PRINT_NORMAL, "Attempting to save user file: %s", fullFilePath);
 
-    FileIO *file = fOpen(fullFilePath, "wb");
-    if (file) {
-        fWrite(buffer, 1, bufSize, file);
-        fClose(file);
+    bool32 success = WriteUserFile(fullFilePath, buffer, bufSize);
 
-        if (postLoadSaveFileCB)
-            postLoadSaveFileCB();
+    if (postLoadSaveFileCB)
+        postLoadSaveFileCB();
 
-        return true;
+    if (!success)
+        PrintLog(PRINT_NORMAL, "Nope!");
+
+    return success;
+}
+void RSDK::SKU::SaveUserFileAsync(const char *filename, void *buffer, uint32 bufSize, void (*callback)(int32 status))
+{
+    // the pre/post callbacks are there for platforms that need to mount storage around saves, so those have to stay on this thread
+    // android's file handles also come from the java side, so keep it synchronous there too
+    // input replays need each callback to land on the same frame every run, so they always save synchronously as well
+#if RETRO_PLATFORM != RETRO_ANDROID
+    if (!preLoadSaveFileCB && !postLoadSaveFileCB && inputReplayMode == INPUTREPLAY_NONE) {
+        char fullFilePath[0x400];
+        GetUserFilePath(fullFilePath, sizeof(fullFilePath), filename);
+        PrintLog(PRINT_NORMAL, "Queueing save of user file: %s", fullFilePath);
+
+        bool32 startWriter = false;
+        {
+            std::lock_guard<std::mutex> lock(userFileWriteMutex);
+
+            // if there's already a save waiting for this file, just swap its data out for the newer one
+            UserFileWrite *write = NULL;
+            for (auto &queued : userFileWriteQueue) {
+                if (queued.path == fullFilePath) {
+                    write = &queued;
+                    break;
+                }
+            }
+
+            if (!write) {
+                userFileWriteQueue.push_back(UserFileWrite());
+                write       = &userFileWriteQueue.back();
+                write->path = fullFilePath;
+            }
+
+            write->data.assign((uint8 *)buffer, (uint8 *)buffer + bufSize);
+            write->callbacks.push_back(callback);
+
+            startWriter          = !userFileWriterActive;
+            userFileWriterActive = true;
+        }
+
+        if (startWriter)
+            RunJob(&userFileWriteGroup, RunUserFileWriter);
+        return;
     }
-    else {
-        if (postLoadSaveFileCB)
-            postLoadSaveFileCB();
+#endif
 
-        PrintLog(PRINT_NORMAL, "Nope!");
+    bool32 success = SaveUserFile(filename, buffer, bufSize);
+
+    std::lock_guard<std::mutex> lock(userFileWriteMutex);
+    userFileWriteResults.push_back({ { callback }, success ? STATUS_OK : STATUS_ERROR });
+}
+void RSDK::SKU::ProcessUserFileWrites()
+{
+    std::vector<UserFileWriteResult> results;
+    {
+        std::lock_guard<std::mutex> lock(userFileWriteMutex);
+        results.swap(userFileWriteResults);
+    }
+
+    for (auto &result : results) {
+        for (auto &callback : result.callbacks) {
+            if (callback)
+                callback(result.status);
+        }
     }
-    return false;
 }
+void RSDK::SKU::FlushUserFileWrites() { WaitForJobGroup(&userFileWriteGroup); }
 bool32 RSDK::SKU::DeleteUserFile(const char *filename)
 {
     if (preLoadSaveFileCB)
@@ -1136,14 +1331,12 @@ bool32 RSDK::SKU::TryLoadUserFile(const char *filename, void *buffer, uint32 siz
 }
 bool32 RSDK::SKU::TrySaveUserFile(const char *filename, void *buffer, uint32 size, void (*callback)(int32 status))
 {
-    bool32 success = false;
-
-    success = SaveUserFile(filename, buffer, size);
+    // without a callback the return value is the only way to hear about a failed write, so it has to wait on the write itself
+    if (!callback)
+        return SaveUserFile(filename, buffer, size);
 
-    if (callback)
-        callback(success ? STATUS_OK : STATUS_ERROR);
-
-    return success;
+    SaveUserFileAsync(filename, buffer, size, callback);
+    return true;
 }
 #endif
 
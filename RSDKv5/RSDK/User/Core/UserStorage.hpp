@@ -1,6 +1,8 @@
 #ifndef USER_STORAGE_H
 #define USER_STORAGE_H
 
+#include <unordered_map>
+
 namespace RSDK
 {
 namespace SKU
@@ -159,6 +161,7 @@ struct UserDB {
     void SortRows(int32 type, char *name, bool32 sortAscending);
 
     uint32 CreateRowUUID();
+    void RefreshRowLookup();
     void Refresh();
     size_t GetSize();
 
@@ -178,6 +181,10 @@ struct UserDB {
     uint32 columnUUIDs[RETRO_USERDB_COL_MAX];
     uint16 rowCount = 0;
     UserDBRow rows[RETRO_USERDB_ROW_MAX];
+
+    // uuid -> row index, rebuilt whenever rows get shuffled around
+    std::unordered_map<uint32, uint16> rowLookup;
+    bool32 rowLookupValid = false;
 };
 
 struct UserDBStorage {
@@ -412,8 +419,17 @@ bool32 LoadUserFile(const char *filename, void *buffer, uint32 bufSize);
 bool32 SaveUserFile(const char *filename, void *buffer, uint32 bufSize);
 bool32 DeleteUserFile(const char *filename);
 
+// copies the buffer & hands it off to the background writer, saves to the same file that haven't started yet get merged together
+// callback is fired from ProcessUserFileWrites (on the main thread) once the file has been written
+void SaveUserFileAsync(const char *filename, void *buffer, uint32 bufSize, void (*callback)(int32 status));
+void ProcessUserFileWrites();
+// blocks until every queued save is on disk, callbacks still go out on the next ProcessUserFileWrites
+void FlushUserFileWrites();
+
 #if !RETRO_REV02
 bool32 TryLoadUserFile(const char *filename, void *buffer, uint32 size, void (*callback)(int32 status));
+// with a callback the save is queued & the write's status goes out through it, so the return value only means it was queued
+// without one it's written straight away & the return value is whether that worked
 bool32 TrySaveUserFile(const char *filename, void *buffer, uint32 size, void (*callback)(int32 status));
 #endif
 
@@ -79,12 +79,14 @@ void DummyUserStorage::ProcessFileLoadTime()
                     break;
 
                 case 2:
-                    success = SaveUserFile(file->path, file->fileBuffer, file->fileSize);
-                    status  = STATUS_ERROR;
+                    // the writer keeps its own copy of the data & fires the callback itself once it's done
+                    SaveUserFileAsync(file->path, file->fileBuffer, file->fileSize, file->callback);
 
                     if (file->compressed)
                         RemoveStorageEntry((void **)&file->fileBuffer);
-                    break;
+
+                    fileList.Remove(f);
+                    continue;
 
                 case 3:
                     success = DeleteUserFile(file->path);